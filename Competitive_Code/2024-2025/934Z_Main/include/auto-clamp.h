@@ -0,0 +1,30 @@
+#ifndef AUTO_CLAMP_H
+#define AUTO_CLAMP_H
+
+/**
+ * @brief AutoClamp class fires the mobile goal clamp as soon as a goal is confirmed at the clamp
+ * @details See auto-clamp.cpp for full explanation and implementation
+ */
+class AutoClamp
+{
+public:
+  AutoClamp(vex::pneumatics &newClamp, bool (*newGoalDetected)());
+  void update();
+  void toggle();
+  void setClamped(bool newClamped);
+  void setAutoEnabled(bool newAutoEnabled);
+  bool isAutoEnabled();
+  bool isClamped();
+
+private:
+  vex::pneumatics &clamp;
+  bool (*goalDetected)();
+  bool autoEnabled;
+  bool clamped;
+  bool lockedOut;
+  int contactTicks;
+  int clearTicks;
+  vex::timer contactTimer;
+};
+
+#endif
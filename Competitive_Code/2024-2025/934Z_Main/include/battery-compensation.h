@@ -0,0 +1,34 @@
+#ifndef BATTERY_COMPENSATION_H
+#define BATTERY_COMPENSATION_H
+
+/**
+ * @brief BatteryCompensation class scales voltage commands so motors see the same voltage at any charge
+ * @details See battery-compensation.cpp for full explanation and implementation
+ */
+class BatteryCompensation
+{
+public:
+  BatteryCompensation(vex::brain::battery &newBattery, double newNominalVoltage);
+  void update();
+  double toVolts(double percent);
+  double getScale();
+  double getFilteredVoltage();
+  double getInternalResistance();
+  double getOpenCircuitVoltage();
+
+private:
+  vex::brain::battery &battery;
+  double nominalVoltage;
+  bool started;
+  double filteredVoltage;
+  double scale;
+  double fitWeight;
+  double fitCurrent;
+  double fitVoltage;
+  double fitCurrentCurrent;
+  double fitCurrentVoltage;
+  double internalResistance;
+  double openCircuitVoltage;
+};
+
+#endif
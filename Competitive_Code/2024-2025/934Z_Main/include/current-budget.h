@@ -0,0 +1,43 @@
+#ifndef CURRENT_BUDGET_H
+#define CURRENT_BUDGET_H
+
+#include <string>
+#include <vector>
+
+class ThermalModel;
+
+/**
+ * @brief CurrentBudget class shares a robot-wide current budget between subsystems by priority
+ * @details See current-budget.cpp for full explanation and implementation
+ */
+class CurrentBudget
+{
+public:
+  CurrentBudget(double newTotalBudget);
+  void setThermalModel(ThermalModel *newThermalModel);
+  void addSubsystem(std::string name, int priority, std::vector<vex::motor> motors);
+  void update();
+  bool isThrottled(std::string name);
+  double getMotorLimit(std::string name);
+  int getThrottleEvents();
+
+private:
+  struct Subsystem
+  {
+    std::string name;
+    int priority;
+    std::vector<vex::motor> motors;
+    double motorLimit;
+    std::vector<double> motorLimits;
+    bool throttled;
+    double throttleStartTime;
+  };
+  std::vector<Subsystem> subsystems;
+  double totalBudget;
+  int throttleEvents;
+  ThermalModel *thermalModel;
+  vex::timer budgetTimer;
+  Subsystem *findSubsystem(std::string name);
+};
+
+#endif
@@ -0,0 +1,39 @@
+#ifndef DRIVE_KINEMATICS_H
+#define DRIVE_KINEMATICS_H
+
+class BatteryCompensation;
+
+/**
+ * @brief DriveKinematics class maps side commands onto whichever drive motors are still working
+ * @details See drive-kinematics.cpp for full explanation and implementation
+ */
+class DriveKinematics
+{
+public:
+  enum Wheels
+  {
+    LEFT_FRONT,
+    LEFT_BACK,
+    RIGHT_FRONT,
+    RIGHT_BACK,
+    NUMBER_OF_WHEELS
+  };
+
+  DriveKinematics(vex::motor newLeftFront, vex::motor newLeftBack, vex::motor newRightFront, vex::motor newRightBack, BatteryCompensation &newBatteryCompensation);
+  void update();
+  void spin(double leftCommand, double rightCommand);
+  void spinFor(double leftDegrees, double rightDegrees, double velocity);
+  double getGain(int wheel);
+  double getSpeedLimit();
+  int getWorkingMotors();
+
+private:
+  vex::motor wheels[NUMBER_OF_WHEELS];
+  BatteryCompensation &batteryCompensation;
+  double gains[NUMBER_OF_WHEELS];
+  double speedLimit;
+  int workingMotors;
+  bool isLeftWheel(int wheel);
+};
+
+#endif
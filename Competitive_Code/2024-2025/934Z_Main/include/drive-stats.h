@@ -0,0 +1,34 @@
+#ifndef DRIVE_STATS_H
+#define DRIVE_STATS_H
+
+#include <string>
+#include "traction-control.h"
+
+/**
+ * @brief DriveStats class measures drive current peaks and wheel slip events
+ * @details See drive-stats.cpp for full explanation and implementation
+ */
+class DriveStats
+{
+public:
+  DriveStats(vex::motor newLeftFront, vex::motor newLeftBack, vex::motor newRightFront, vex::motor newRightBack, TractionControl &newTractionControl);
+  void update();
+  void print(std::string label);
+  void reset();
+  double getPeakCurrent();
+  int getSlipEvents();
+
+private:
+  vex::motor leftFront;
+  vex::motor leftBack;
+  vex::motor rightFront;
+  vex::motor rightBack;
+  TractionControl &tractionControl;
+  double peakCurrent;
+  int slipEvents;
+  bool leftSlipping;
+  bool rightSlipping;
+  bool checkSlip(bool slippingNow, bool &slipping);
+};
+
+#endif
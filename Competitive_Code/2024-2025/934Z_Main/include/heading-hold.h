@@ -0,0 +1,27 @@
+#ifndef HEADING_HOLD_H
+#define HEADING_HOLD_H
+
+/**
+ * @brief HeadingHold class keeps the robot on the heading it had when the driver pushes both sticks together
+ * @details See heading-hold.cpp for full explanation and implementation
+ */
+class HeadingHold
+{
+public:
+  HeadingHold(vex::inertial newSensor);
+  void apply(double &leftCommand, double &rightCommand);
+  void release();
+  bool isHolding();
+  double getHeadingError();
+
+private:
+  vex::inertial sensor;
+  bool holding;
+  bool captured;
+  double targetRotation;
+  double lastRotation;
+  double integral;
+  double headingError;
+};
+
+#endif
@@ -0,0 +1,29 @@
+#ifndef JAM_DETECTOR_H
+#define JAM_DETECTOR_H
+
+#include <string>
+
+/**
+ * @brief JamDetector class drives one intake motor and clears jams automatically
+ * @details See jam-detector.cpp for full explanation and implementation
+ */
+class JamDetector
+{
+public:
+  JamDetector(vex::motor newIntakeMotor, std::string newMotorName);
+  void update(double commandedVelocity);
+  bool isClearing();
+  int getJamCount();
+
+private:
+  vex::motor intakeMotor;
+  std::string motorName;
+  double lastCommandedVelocity;
+  int spinUpTicks;
+  int stalledTicks;
+  bool clearing;
+  int jamCount;
+  vex::timer clearTimer;
+};
+
+#endif
@@ -0,0 +1,104 @@
+#ifndef JOYSTICK_CURVES_H
+#define JOYSTICK_CURVES_H
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       joystick-curves.h                                         */
+/*    Created:      10/18/2026                                                */
+/*    Description:  Compile-time joystick response curves                    */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief 256-entry lookup table from a raw joystick value to a percent motor command
+ * @details Indexed by Axis.value() + 128, so entry 1 is full reverse (-127), entry 128 is
+ * center (0) and entry 255 is full forward (127). Entry 0 (-128) never occurs and reads as full reverse.
+ */
+struct CurveTable
+{
+  float values[256];
+
+  /**
+   * @brief looks up the percent command for a raw joystick value
+   * @param axisValue int raw joystick value from Axis.value(), -127 to 127
+   * @returns float percent command, -100 to 100
+   */
+  float operator()(int axisValue) const
+  {
+    return values[axisValue + 128];
+  }
+};
+
+// Compile-time list of table indices used to expand one curve evaluation per entry (std::index_sequence is C++14)
+template <int... Indices>
+struct CurveIndexList
+{
+};
+
+template <int N, int... Indices>
+struct MakeCurveIndexList : MakeCurveIndexList<N - 1, N - 1, Indices...>
+{
+};
+
+template <int... Indices>
+struct MakeCurveIndexList<0, Indices...>
+{
+  typedef CurveIndexList<Indices...> type;
+};
+
+/**
+ * @brief raw joystick value for a table index, clamped to the -127 to 127 range the controller reports
+ */
+constexpr float curveStickFraction(int index)
+{
+  return (index - 128 < -127 ? -127 : index - 128) / 127.0f;
+}
+
+/**
+ * @brief removes the deadband and rescales what is left to the full 0 to 1 range
+ */
+constexpr float curveRemoveDeadband(float magnitude, float deadband)
+{
+  return magnitude <= deadband ? 0.0f : (magnitude - deadband) / (1.0f - deadband);
+}
+
+/**
+ * @brief blends linear and cubic response; expo 0 is linear, 1 is fully cubic
+ */
+constexpr float curveApplyExpo(float magnitude, float expo)
+{
+  return (1.0f - expo) * magnitude + expo * magnitude * magnitude * magnitude;
+}
+
+/**
+ * @brief percent command for a signed stick fraction with deadband, expo and rate applied
+ */
+constexpr float curveShape(float stick, float deadband, float expo, float rate)
+{
+  return (stick < 0 ? -1.0f : 1.0f) * curveApplyExpo(curveRemoveDeadband(stick < 0 ? -stick : stick, deadband), expo) * rate * 100.0f;
+}
+
+template <int DeadbandPct, int ExpoPct, int RatePct, int... Indices>
+constexpr CurveTable buildCurveTable(CurveIndexList<Indices...>)
+{
+  return CurveTable{{curveShape(curveStickFraction(Indices), DeadbandPct / 100.0f, ExpoPct / 100.0f, RatePct / 100.0f)...}};
+}
+
+/**
+ * @brief builds a joystick response curve table at compile time
+ * @details Each entry applies, in order, a deadband that is removed and the remaining travel rescaled so
+ * the curve still starts at zero, an expo blend between linear and cubic response for finer control near
+ * center, and a dual-rate scale on the final output. No pow() or other math runs on the brain; a curve
+ * costs one table lookup per axis per tick.
+ * @tparam DeadbandPct percent of stick travel around center that outputs zero
+ * @tparam ExpoPct percent of cubic response blended into the linear response
+ * @tparam RatePct percent of full motor command at full stick
+ * @returns CurveTable usable as a constexpr
+ */
+template <int DeadbandPct, int ExpoPct, int RatePct>
+constexpr CurveTable makeCurveTable()
+{
+  return buildCurveTable<DeadbandPct, ExpoPct, RatePct>(typename MakeCurveIndexList<256>::type());
+}
+
+#endif
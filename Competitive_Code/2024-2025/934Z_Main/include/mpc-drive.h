@@ -0,0 +1,35 @@
+#ifndef MPC_DRIVE_H
+#define MPC_DRIVE_H
+
+#include "qp-solver.h"
+
+/**
+ * @brief MpcDrive class picks one drive side's voltage by optimizing it over a short horizon under the motor's limits
+ * @details See mpc-drive.cpp for full explanation and implementation
+ */
+class MpcDrive
+{
+public:
+  static const int HORIZON = 15;
+
+  MpcDrive(double newTimeConstant, double newTickTime);
+  void setLimits(double newMaxVoltage, double newMaxAcceleration, double newMaxCurrent);
+  double update(double velocity, double reference);
+  void reset(double voltage);
+  int getIterations();
+  bool isConverged();
+
+private:
+  QpSolver solver;
+  bool ready;
+  double decay;
+  double inputGain;
+  double response[HORIZON + 1][HORIZON];
+  double freeResponse[HORIZON + 1];
+  double rowFreeResponse[3 * HORIZON];
+  double rowLimit[3 * HORIZON];
+  double lastVoltage;
+  int iterations;
+};
+
+#endif
@@ -0,0 +1,35 @@
+#ifndef QP_SOLVER_H
+#define QP_SOLVER_H
+
+/**
+ * @brief QpSolver class solves small box and linear inequality constrained quadratic programs without allocating
+ * @details See qp-solver.cpp for full explanation and implementation
+ */
+class QpSolver
+{
+public:
+  static const int MAX_VARIABLES = 20;
+  static const int MAX_CONSTRAINTS = 60;
+
+  QpSolver();
+  bool setup(int newVariables, int newConstraints, const double *newCost, const double *newConstraintMatrix);
+  int solve(const double *linearCost, const double *lowerBounds, const double *upperBounds);
+  const double *getSolution();
+  bool isConverged();
+
+private:
+  int variables;
+  int constraints;
+  double cost[MAX_VARIABLES][MAX_VARIABLES];
+  double constraintMatrix[MAX_CONSTRAINTS][MAX_VARIABLES];
+  double factor[MAX_VARIABLES][MAX_VARIABLES];
+  double solution[MAX_VARIABLES];
+  double previousSolution[MAX_VARIABLES];
+  double slack[MAX_CONSTRAINTS];
+  double dual[MAX_CONSTRAINTS];
+  double right[MAX_VARIABLES];
+  bool converged;
+  void solveFactored(double *vector);
+};
+
+#endif
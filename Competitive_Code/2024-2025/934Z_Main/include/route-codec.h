@@ -0,0 +1,71 @@
+#ifndef ROUTE_CODEC_H
+#define ROUTE_CODEC_H
+
+#include <stdint.h>
+#include <vector>
+#include "route.h"
+
+// Stored position units per degree; positions are rounded to a tenth of a degree, finer than the encoders
+const int ROUTE_POSITION_SCALE = 10;
+// Starting value of a route checksum, the 32-bit FNV-1a offset basis
+const uint32_t ROUTE_CHECKSUM_SEED = 2166136261u;
+
+/**
+ * @brief RouteTable struct is a compressed route linked into the program, as written by tools/route-compiler.cpp
+ * @details duration is the msec from the first record to the last, and checksum the route checksum of data
+ */
+struct RouteTable
+{
+  const uint8_t *data;
+  int size;
+  int records;
+  uint32_t duration;
+  uint32_t checksum;
+};
+
+/**
+ * @brief RouteEncoder class compresses route records into the byte stream RouteTableSource decodes
+ * @details See route-codec.cpp for full explanation and implementation
+ */
+class RouteEncoder
+{
+public:
+  RouteEncoder();
+  void add(const RouteRecord &record);
+  const std::vector<uint8_t> &getData();
+  int getRecords();
+
+private:
+  std::vector<uint8_t> data;
+  int records;
+  uint32_t lastTime;
+  uint8_t lastFlags;
+  int32_t positions[NUMBER_OF_ROUTE_CHANNELS];
+  int32_t deltas[NUMBER_OF_ROUTE_CHANNELS];
+  void addVarint(uint32_t value);
+};
+
+/**
+ * @brief RouteTableSource class decodes a compressed route table one record at a time during playback
+ * @details See route-codec.cpp for full explanation and implementation
+ */
+class RouteTableSource : public RouteSource
+{
+public:
+  RouteTableSource(const RouteTable &newTable);
+  bool next(RouteRecord &record);
+
+private:
+  const RouteTable *table;
+  int offset;
+  int records;
+  uint32_t time;
+  uint8_t flags;
+  int32_t positions[NUMBER_OF_ROUTE_CHANNELS];
+  int32_t deltas[NUMBER_OF_ROUTE_CHANNELS];
+  uint32_t readVarint();
+};
+
+uint32_t updateRouteChecksum(uint32_t checksum, const uint8_t *data, int size);
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef ROUTE_LIBRARY_H
+#define ROUTE_LIBRARY_H
+
+#include "route-sources.h"
+#include "route-mirror.h"
+
+// Alliance a route is meant for
+enum AllianceSides
+{
+  RED_ALLIANCE,
+  BLUE_ALLIANCE,
+  EITHER_ALLIANCE
+};
+
+/**
+ * @brief RouteEntry struct is one autonomous route the selector can pick
+ * @details startPose is where the robot is placed before the route, in inches from the field center with x
+ * across the centerline and heading clockwise from +y; startMeasured stays false until that pose has been measured
+ * where the route was really recorded, and until then the selector shows no placement. table is the built-in route, or NULL for a route that
+ * does nothing; fileName, if not NULL, is an SD card route that replaces it. mirrored entries play their route
+ * through MirrorAcrossCenterline, so the other alliance needs no recording of its own.
+ */
+struct RouteEntry
+{
+  const char *name;
+  AllianceSides side;
+  RoutePose startPose;
+  bool startMeasured;
+  const RouteTable *table;
+  const char *fileName;
+  bool mirrored;
+};
+
+/**
+ * @brief RouteLibrary class is the registry of autonomous routes, loading and checking each one only once it is selected
+ * @details See route-library.cpp for full explanation and implementation
+ */
+class RouteLibrary
+{
+public:
+  RouteLibrary(const RouteEntry *newEntries, int newCount);
+  int getCount();
+  const RouteEntry &getEntry(int index);
+  void select(int index);
+  int getSelected();
+  bool isVerified();
+  bool isFromCard();
+  double getDuration();
+  uint32_t getChecksum();
+  RouteSource *open();
+
+private:
+  const RouteEntry *entries;
+  int count;
+  int selected;
+  bool verified;
+  bool fromCard;
+  uint32_t duration;
+  uint32_t checksum;
+  RouteFileSource fileSource;
+  RouteTableSource tableSource;
+  MirroredRouteSource mirroredFileSource;
+  MirroredRouteSource mirroredTableSource;
+};
+
+#endif
@@ -0,0 +1,98 @@
+#ifndef ROUTE_MIRROR_H
+#define ROUTE_MIRROR_H
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       route-mirror.h                                            */
+/*    Created:      10/18/2026                                                */
+/*    Description:  Compile-time route transforms for playing one recording   */
+/*                  on either alliance side                                   */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include "route-model.h"
+
+/**
+ * @brief route transform that mirrors a route across the field centerline
+ * @details A tank drive's mirror image swaps what its sides do: the left side drives the path the right
+ * side drove, so every turn comes out the other way with the same magnitude while forward travel is
+ * unchanged. Arm, intake and clamp are the same on either side of the field and pass through untouched.
+ * A transform is any struct with these two constexpr functions, so others can be added alongside.
+ */
+struct MirrorAcrossCenterline
+{
+  /**
+   * @brief channel a transformed record's channel is read from
+   * @param channel int index from the RouteChannels enum
+   * @returns int index from the RouteChannels enum
+   */
+  static constexpr int channel(int channel)
+  {
+    return channel == LEFT_FRONT_CHANNEL    ? RIGHT_FRONT_CHANNEL
+           : channel == LEFT_BACK_CHANNEL   ? RIGHT_BACK_CHANNEL
+           : channel == RIGHT_FRONT_CHANNEL ? LEFT_FRONT_CHANNEL
+           : channel == RIGHT_BACK_CHANNEL  ? LEFT_BACK_CHANNEL
+                                            : channel;
+  }
+
+  /**
+   * @brief a field pose, measured from the centerline, on the other side of it
+   * @param pose RoutePose with x across the centerline and heading clockwise from +y
+   * @returns RoutePose mirrored, with x and heading negated
+   */
+  static constexpr RoutePose pose(RoutePose pose)
+  {
+    return RoutePose{-pose.x, pose.y, -pose.heading};
+  }
+};
+
+/**
+ * @brief RouteSource that plays another source's records through a compile-time transform
+ * @details The transform is applied lazily, once to each record as it leaves the source, never to the
+ * interpolated targets RoutePlayer works out every tick, so playback costs exactly the same per tick as
+ * the untransformed route and the timing is identical. Transform::channel() is constexpr and the channel
+ * loop has a fixed count, so the compiler resolves the whole transform into eight plain copies. Route
+ * tables, SD card files and streamed files can all be wrapped, so one recording yields both sides
+ * without doubling recording time or flash.
+ * @tparam Transform struct with constexpr channel() and pose(), such as MirrorAcrossCenterline
+ */
+template <class Transform>
+class TransformedRouteSource : public RouteSource
+{
+public:
+  /**
+   * @brief constructs a TransformedRouteSource
+   * @param newSource RouteSource whose records are transformed, which must outlive this source
+   */
+  TransformedRouteSource(RouteSource &newSource) : source(newSource)
+  {
+  }
+
+  /**
+   * @brief copies out the source's next record, transformed
+   * @param record RouteRecord set to the next record
+   * @returns bool false once the source has no more records
+   */
+  bool next(RouteRecord &record)
+  {
+    RouteRecord original;
+    if (!source.next(original))
+    {
+      return false;
+    }
+    record = original;
+    for (int i = 0; i < NUMBER_OF_ROUTE_CHANNELS; i++)
+    {
+      record.positions[i] = original.positions[Transform::channel(i)];
+    }
+    return true;
+  }
+
+private:
+  RouteSource &source;
+};
+
+// A route recorded on one side of the field, played on the other
+typedef TransformedRouteSource<MirrorAcrossCenterline> MirroredRouteSource;
+
+#endif
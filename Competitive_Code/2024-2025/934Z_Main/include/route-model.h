@@ -0,0 +1,50 @@
+#ifndef ROUTE_MODEL_H
+#define ROUTE_MODEL_H
+
+#include "route.h"
+
+// Drive motor degrees per inch of travel and per degree of turn, the benchmarks drive() and turn() use
+extern const double ROUTE_DRIVE_DEGREES_PER_INCH;
+extern const double ROUTE_DRIVE_DEGREES_PER_TURN_DEGREE;
+// Each channel's top speed in degrees per second and acceleration in degrees per second squared
+extern const double ROUTE_CHANNEL_MAX_VELOCITY[NUMBER_OF_ROUTE_CHANNELS];
+extern const double ROUTE_CHANNEL_MAX_ACCELERATION[NUMBER_OF_ROUTE_CHANNELS];
+// Each channel's acceleration in degrees per second squared per amp, and the motor's winding resistance and supply
+extern const double ROUTE_CHANNEL_ACCELERATION_PER_AMP[NUMBER_OF_ROUTE_CHANNELS];
+extern const double ROUTE_MOTOR_RESISTANCE;
+extern const double ROUTE_MAX_VOLTAGE;
+
+/**
+ * @brief RoutePose struct is the robot's position in inches and heading in degrees, clockwise, relative to where a route starts
+ */
+struct RoutePose
+{
+  double x;
+  double y;
+  double heading;
+};
+
+/**
+ * @brief RouteOdometry class dead-reckons the robot's pose from a route's drive channels
+ * @details See route-model.cpp for full explanation and implementation
+ */
+class RouteOdometry
+{
+public:
+  RouteOdometry();
+  void reset(const RouteRecord &record);
+  void reset(const RouteRecord &record, RoutePose startPose);
+  RoutePose update(const RouteRecord &record);
+  RoutePose getPose();
+
+private:
+  RoutePose pose;
+  double lastLeft;
+  double lastRight;
+};
+
+double getSidePosition(const RouteRecord &record, bool left);
+void interpolateChannel(const RouteRecord &before, const RouteRecord &first, const RouteRecord &last, const RouteRecord &after,
+                        int channel, double time, double &position, double &velocity);
+
+#endif
@@ -0,0 +1,69 @@
+#ifndef ROUTE_PLAYER_H
+#define ROUTE_PLAYER_H
+
+#include <vector>
+#include "auto-clamp.h"
+#include "drive-kinematics.h"
+#include "battery-compensation.h"
+#include "route-model.h"
+
+/**
+ * @brief RouteTrackingStats struct is how closely the robot followed the last route played
+ * @details Cross-track and along-track errors are in inches, sideways from and along the route's path,
+ * heading error in degrees, mechanism error in motor degrees, and time shift the milliseconds the schedule
+ * was held back because the robot lagged.
+ */
+struct RouteTrackingStats
+{
+  int ticks;
+  double rmsCrossTrack;
+  double maxCrossTrack;
+  double maxAlongTrack;
+  double maxHeadingError;
+  double maxMechanismError;
+  double timeShift;
+};
+
+/**
+ * @brief RoutePlayer class replays a recorded route closed-loop, interpolating every channel each tick, correcting the drive's drift and firing clamp events
+ * @details See route-player.cpp for full explanation and implementation
+ */
+class RoutePlayer
+{
+public:
+  RoutePlayer(AutoClamp &newAutoClamp, DriveKinematics &newDriveKinematics, BatteryCompensation &newBatteryCompensation);
+  void addMotor(vex::motor motor);
+  bool start(RouteSource &newSource);
+  bool update();
+  void stop();
+  bool isPlaying();
+  double getTime();
+  RouteTrackingStats getStats();
+
+private:
+  std::vector<vex::motor> motors;
+  AutoClamp &autoClamp;
+  DriveKinematics &driveKinematics;
+  BatteryCompensation &batteryCompensation;
+  RouteSource *source;
+  RouteRecord window[4];
+  bool haveNext;
+  double startTime;
+  double routeTime;
+  double lastTickTime;
+  double rate;
+  double offsets[NUMBER_OF_ROUTE_CHANNELS];
+  bool playing;
+  uint8_t playedFlags;
+  RouteOdometry targetOdometry;
+  RouteOdometry actualOdometry;
+  RouteTrackingStats stats;
+  double crossTrackSquares;
+  vex::timer playTimer;
+  void advance();
+  void playEvents(const RouteRecord &record);
+  void finish();
+  bool isLostDriveMotor(int channel);
+};
+
+#endif
@@ -0,0 +1,54 @@
+#ifndef ROUTE_RECORDER_H
+#define ROUTE_RECORDER_H
+
+#include <stdio.h>
+#include <vector>
+#include "route.h"
+
+/**
+ * @brief RouteRecorder class samples every mechanism into fixed-size binary records and streams them to the SD card
+ * @details See route-recorder.cpp for full explanation and implementation
+ */
+class RouteRecorder
+{
+public:
+  static const int RECORDS_PER_BUFFER = 100;
+
+  RouteRecorder(vex::brain::sdcard &newCard, vex::pneumatics &newClamp, int newSamplePeriod);
+  void addMotor(vex::motor motor);
+  bool start();
+  void sample();
+  void poll();
+  void stop();
+  bool isRecording();
+  int getSamplePeriod();
+  int getRecordCount();
+  int getDroppedRecords();
+  int getEventCount();
+  const char *getFileName();
+
+private:
+  vex::brain::sdcard &card;
+  vex::pneumatics &clamp;
+  std::vector<vex::motor> motors;
+  int samplePeriod;
+  RouteRecord buffers[2][RECORDS_PER_BUFFER];
+  volatile int bufferCounts[2];
+  volatile bool bufferFull[2];
+  int sampleBuffer;
+  volatile bool recording;
+  volatile bool writing;
+  FILE *file;
+  char fileName[16];
+  int recordCount;
+  int droppedRecords;
+  int eventCount;
+  uint8_t lastFlags;
+  vex::timer recordTimer;
+  static int writeTask(void *recorder);
+  void writeBuffers();
+  uint8_t getFlags();
+  void addRecord(uint8_t flags);
+};
+
+#endif
@@ -0,0 +1,34 @@
+#ifndef ROUTE_RETIME_H
+#define ROUTE_RETIME_H
+
+#include <vector>
+#include "route-model.h"
+
+/**
+ * @brief RouteRetimer class gives a route's path the fastest timing its motors' velocity, acceleration and current allow
+ * @details See route-retime.cpp for full explanation and implementation
+ */
+class RouteRetimer
+{
+public:
+  RouteRetimer(double newSpeedScale, double newMaxCurrent);
+  std::vector<RouteRecord> retime(const std::vector<RouteRecord> &records);
+  double getOriginalDuration();
+  double getRetimedDuration();
+
+private:
+  struct Segment
+  {
+    double length;
+    double directions[NUMBER_OF_ROUTE_CHANNELS];
+    double dwell;
+  };
+  double speedScale;
+  double maxCurrent;
+  double originalDuration;
+  double retimedDuration;
+  double getAcceleration(const Segment &segment, double speed, bool speedingUp);
+  double getSegmentTime(const Segment &segment, double startSpeed, double endSpeed);
+};
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef ROUTE_SIMPLIFY_H
+#define ROUTE_SIMPLIFY_H
+
+#include <vector>
+#include "route-model.h"
+
+/**
+ * @brief RouteSimplifier class drops the records of a route that playback can rebuild within stated tolerances
+ * @details See route-simplify.cpp for full explanation and implementation
+ */
+class RouteSimplifier
+{
+public:
+  RouteSimplifier(double newPositionTolerance, double newHeadingTolerance, double newMechanismTolerance);
+  std::vector<RouteRecord> simplify(const std::vector<RouteRecord> &records);
+  int getOriginalPoints();
+  int getSimplifiedPoints();
+  double getDuration();
+  double getMaxError();
+
+private:
+  double positionTolerance;
+  double headingTolerance;
+  double mechanismTolerance;
+  int originalPoints;
+  int simplifiedPoints;
+  double duration;
+  double maxError;
+  double getWorstError(const std::vector<RouteRecord> &records, const std::vector<RoutePose> &poses, const std::vector<bool> &kept, int first, int last, int &worst);
+};
+
+#endif
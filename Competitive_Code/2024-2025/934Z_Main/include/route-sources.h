@@ -0,0 +1,42 @@
+#ifndef ROUTE_SOURCES_H
+#define ROUTE_SOURCES_H
+
+#include <stdio.h>
+#include <vector>
+#include "route-codec.h"
+
+/**
+ * @brief RouteFileSource class streams a route file from the SD card in fixed-size chunks prefetched by a background task
+ * @details See route-sources.cpp for full explanation and implementation
+ */
+class RouteFileSource : public RouteSource
+{
+public:
+  static const int RECORDS_PER_CHUNK = 64;
+  static const int NUMBER_OF_CHUNKS = 3;
+
+  RouteFileSource();
+  ~RouteFileSource();
+  bool open(const char *fileName);
+  bool next(RouteRecord &record);
+  void close();
+  int getUnderruns();
+  static bool inspect(const char *fileName, uint32_t &duration, uint32_t &checksum);
+
+private:
+  std::vector<RouteRecord> chunks;
+  volatile int chunkCounts[NUMBER_OF_CHUNKS];
+  volatile bool chunkReady[NUMBER_OF_CHUNKS];
+  int readChunk;
+  int index;
+  FILE *file;
+  volatile bool prefetching;
+  volatile bool closing;
+  int underruns;
+  static FILE *openRoute(const char *fileName);
+  static int prefetchTask(void *source);
+  void prefetch();
+  int readChunkFromFile(int chunk);
+};
+
+#endif
@@ -0,0 +1,51 @@
+#ifndef ROUTE_TABLES_H
+#define ROUTE_TABLES_H
+
+// Generated by tools/route-compiler.cpp from recorded route files - DO NOT EDIT, re-run the compiler instead:
+//   --simplify=0.5,2,5 include/route-tables.h MAIN_AUTON_ROUTE=routes/main.bin
+
+#include "route-codec.h"
+
+// routes/main.bin: 55 records, 14.50 sec, 580 bytes
+constexpr uint8_t MAIN_AUTON_ROUTE_DATA[] = {
+    0x00, 0x00, 0xF4, 0x03, 0x0F, 0xC0, 0x02, 0x80, 0x02, 0xD8, 0x01, 0xC0, 0x01, 0xF4, 0x03, 0x0F,
+    0xE8, 0x17, 0xB0, 0x18, 0x90, 0x19, 0xC0, 0x19, 0xD0, 0x0F, 0x0F, 0xC8, 0x90, 0x01, 0xA0, 0x91,
+    0x01, 0xD8, 0x90, 0x01, 0xF0, 0x8F, 0x01, 0xF4, 0x03, 0x0F, 0xB7, 0x8A, 0x01, 0xB7, 0x8A, 0x01,
+    0x9F, 0x7F, 0x87, 0x7F, 0xF4, 0x03, 0x0F, 0xBF, 0x30, 0xAF, 0x31, 0xAF, 0x08, 0x8F, 0x07, 0xF4,
+    0x03, 0x0F, 0xBF, 0x04, 0xCF, 0x03, 0xB7, 0x0C, 0xDF, 0x0D, 0xF4, 0x03, 0x0F, 0xA7, 0x05, 0xEF,
+    0x05, 0x10, 0x60, 0xF4, 0x03, 0x0F, 0xA0, 0x01, 0x68, 0xA8, 0x0F, 0xE8, 0x0F, 0xF4, 0x03, 0x0F,
+    0xA8, 0x14, 0xF0, 0x12, 0x9F, 0x15, 0xD7, 0x15, 0xF4, 0x03, 0x0F, 0xA8, 0x23, 0xF0, 0x24, 0xB0,
+    0x09, 0xE0, 0x08, 0xF4, 0x03, 0x0F, 0xF8, 0x09, 0xC0, 0x09, 0xA8, 0x08, 0xD8, 0x08, 0xF4, 0x03,
+    0x0D, 0x7F, 0xA7, 0x30, 0xE7, 0x2F, 0xF4, 0x03, 0x0F, 0x87, 0x03, 0xFF, 0x02, 0xAF, 0x16, 0x9F,
+    0x17, 0xF4, 0x03, 0x0F, 0xFF, 0x11, 0x97, 0x12, 0xA8, 0x1A, 0xB0, 0x1A, 0xF4, 0x03, 0x0F, 0xE0,
+    0x0B, 0x80, 0x0B, 0xB0, 0x25, 0xB0, 0x25, 0xF4, 0x03, 0x0F, 0xD8, 0x0A, 0xD8, 0x0A, 0xE0, 0x0A,
+    0xE8, 0x0B, 0xF4, 0x03, 0x0F, 0x80, 0x02, 0x80, 0x02, 0x80, 0x03, 0xA0, 0x02, 0xF4, 0x03, 0x0F,
+    0xBF, 0x01, 0x1F, 0xDF, 0x1B, 0x9F, 0x1B, 0xF4, 0x03, 0x0F, 0xAF, 0x1A, 0xFF, 0x1A, 0xD7, 0x14,
+    0xFF, 0x14, 0xF4, 0x03, 0x0F, 0xA8, 0x02, 0xE0, 0x01, 0xB0, 0x17, 0xD0, 0x16, 0xF4, 0x03, 0x0F,
+    0xA8, 0x11, 0xF8, 0x11, 0xB0, 0x12, 0xF8, 0x12, 0xF4, 0x03, 0x0F, 0xB0, 0x04, 0x80, 0x04, 0xCF,
+    0x17, 0xE7, 0x16, 0xF4, 0x03, 0x0F, 0x9F, 0x02, 0x87, 0x02, 0x9F, 0x0B, 0xC7, 0x0C, 0xF4, 0x03,
+    0x0F, 0x88, 0x01, 0x58, 0xA0, 0x1D, 0xF0, 0x1D, 0xF4, 0x03, 0x0F, 0xDF, 0x1A, 0xF7, 0x15, 0xD8,
+    0x0A, 0xC0, 0x0A, 0xF4, 0x03, 0x0F, 0xA7, 0x0A, 0x97, 0x10, 0x30, 0x98, 0x01, 0xF4, 0x03, 0x0F,
+    0xD8, 0x02, 0xB0, 0x02, 0xDF, 0x13, 0xD7, 0x14, 0xF4, 0x03, 0x0F, 0x98, 0x18, 0xA0, 0x18, 0xF8,
+    0x01, 0x88, 0x02, 0xF4, 0x03, 0x0F, 0xD0, 0x0B, 0xF8, 0x0C, 0x10, 0x07, 0xF4, 0x03, 0x0D, 0xCF,
+    0x01, 0xF7, 0x19, 0x87, 0x19, 0xF4, 0x03, 0x0F, 0x8F, 0x18, 0x9F, 0x18, 0x68, 0x20, 0xF4, 0x03,
+    0x0F, 0xC8, 0x03, 0xA0, 0x01, 0xD7, 0x03, 0xEF, 0x03, 0xF4, 0x03, 0x0F, 0xD0, 0x01, 0xF8, 0x01,
+    0xC8, 0x1A, 0x80, 0x1A, 0xE8, 0x07, 0x0F, 0xE8, 0x3F, 0xF8, 0x40, 0xD8, 0x3E, 0x80, 0x40, 0xF4,
+    0x03, 0x0F, 0x9F, 0x26, 0x8F, 0x27, 0xF7, 0x26, 0xDF, 0x27, 0xF4, 0x03, 0x0F, 0x07, 0x08, 0xDF,
+    0x18, 0x9F, 0x18, 0xF4, 0x03, 0x0F, 0x87, 0x13, 0x87, 0x10, 0x87, 0x13, 0x9F, 0x13, 0xF4, 0x03,
+    0x0F, 0xE7, 0x02, 0xEF, 0x07, 0xE0, 0x0D, 0xB0, 0x0D, 0xF4, 0x03, 0x0F, 0xB0, 0x10, 0xA8, 0x13,
+    0xC8, 0x17, 0xD0, 0x18, 0xF4, 0x03, 0x0F, 0xD0, 0x04, 0xD0, 0x03, 0xF7, 0x05, 0x9F, 0x07, 0xF4,
+    0x03, 0x0F, 0x9F, 0x05, 0xB7, 0x03, 0x8F, 0x26, 0xAF, 0x25, 0xF4, 0x03, 0x0F, 0xBF, 0x13, 0xCF,
+    0x15, 0xC8, 0x0B, 0xE0, 0x0A, 0xF4, 0x03, 0x0F, 0xC8, 0x0B, 0xE0, 0x0C, 0x90, 0x11, 0x98, 0x12,
+    0xF4, 0x03, 0x0F, 0xA8, 0x09, 0xC0, 0x09, 0x8F, 0x2A, 0xB7, 0x2A, 0xF4, 0x03, 0x0F, 0xAF, 0x04,
+    0x8F, 0x05, 0xE7, 0x0C, 0xE7, 0x0C, 0xF4, 0x03, 0x0F, 0xC7, 0x12, 0x8F, 0x13, 0x88, 0x21, 0x98,
+    0x20, 0xF4, 0x03, 0x0F, 0xF8, 0x0D, 0x98, 0x0F, 0xA0, 0x20, 0xD0, 0x21, 0xF4, 0x03, 0x0F, 0x38,
+    0xC0, 0x01, 0xC0, 0x09, 0xD0, 0x08, 0xF4, 0x03, 0x0F, 0xD7, 0x18, 0xB7, 0x1B, 0x30, 0x40, 0xF4,
+    0x03, 0x0F, 0xE0, 0x0B, 0x90, 0x0D, 0xD7, 0x03, 0xFF, 0x02, 0xF4, 0x03, 0x0F, 0xC0, 0x14, 0xE0,
+    0x14, 0x0F, 0x6F, 0xF4, 0x03, 0x0F, 0xCF, 0x09, 0xFF, 0x07, 0xF7, 0x09, 0xBF, 0x09, 0xF4, 0x03,
+    0x0F, 0xD7, 0x09, 0xFF, 0x0E, 0xA7, 0x0B, 0x8F, 0x0B, 0xF4, 0x03, 0x0F, 0xD7, 0x10, 0xCF, 0x0D,
+    0x9F, 0x0F, 0xAF, 0x10
+};
+constexpr RouteTable MAIN_AUTON_ROUTE = {MAIN_AUTON_ROUTE_DATA, sizeof(MAIN_AUTON_ROUTE_DATA), 55, 14500, 0xFDE6089A};
+
+#endif
@@ -0,0 +1,65 @@
+#ifndef ROUTE_H
+#define ROUTE_H
+
+#include <stdint.h>
+
+/**
+ * @brief Binary route file format shared by the route recorder and everything that reads routes
+ * @details A route file is one RouteHeader followed by fixed-size RouteRecords in time order, both stored
+ * as the V5's little-endian structs. Every record holds every channel, so a record's offset in the file is
+ * its index times sizeof(RouteRecord) after the header.
+ */
+
+// Motor channels in every record, in the order the recorder's motors are added
+enum RouteChannels
+{
+  LEFT_FRONT_CHANNEL,
+  LEFT_BACK_CHANNEL,
+  RIGHT_FRONT_CHANNEL,
+  RIGHT_BACK_CHANNEL,
+  LEFT_ARM_CHANNEL,
+  RIGHT_ARM_CHANNEL,
+  LEFT_INTAKE_CHANNEL,
+  RIGHT_INTAKE_CHANNEL,
+  NUMBER_OF_ROUTE_CHANNELS
+};
+
+// First four bytes of every route file
+const char ROUTE_MAGIC[4] = {'R', 'T', 'E', '1'};
+// Format version, bumped whenever RouteHeader or RouteRecord change
+const uint16_t ROUTE_VERSION = 1;
+// RouteRecord flags bit set while the clamp is extended
+const uint8_t ROUTE_CLAMP_EXTENDED = 0x01;
+
+struct RouteHeader
+{
+  char magic[4];
+  uint16_t version;
+  uint16_t recordSize;
+  uint16_t samplePeriod;
+  uint16_t channels;
+};
+
+struct RouteRecord
+{
+  uint32_t time;
+  float positions[NUMBER_OF_ROUTE_CHANNELS];
+  uint8_t flags;
+  uint8_t reserved[3];
+};
+
+static_assert(sizeof(RouteHeader) == 12, "RouteHeader layout changed, bump ROUTE_VERSION");
+static_assert(sizeof(RouteRecord) == 40, "RouteRecord layout changed, bump ROUTE_VERSION");
+
+/**
+ * @brief RouteSource class hands a route's records to playback one at a time, in time order
+ * @details See route-sources.cpp and route-codec.cpp for the sources routes can be played from
+ */
+class RouteSource
+{
+public:
+  virtual ~RouteSource() {}
+  virtual bool next(RouteRecord &record) = 0;
+};
+
+#endif
@@ -0,0 +1,45 @@
+#ifndef SCORING_MACRO_H
+#define SCORING_MACRO_H
+
+#include "auto-clamp.h"
+
+/**
+ * @brief ScoringMacro class runs the intake-to-arm handoff and scoring sequence one tick at a time
+ * @details See scoring-macro.cpp for full explanation and implementation
+ */
+class ScoringMacro
+{
+public:
+  enum MacroStages
+  {
+    IDLE,
+    SECURE_GOAL,
+    LOAD_ARM,
+    RAISE_ARM,
+    LOWER_ARM,
+    NUMBER_OF_STAGES
+  };
+
+  ScoringMacro(vex::motor_group &newIntakeMotors, vex::motor_group &newArmMotors, AutoClamp &newAutoClamp, bool (*newGoalDetected)());
+  void start();
+  void cancel();
+  void update();
+  bool isRunning();
+  double getIntakeVelocity();
+  MacroStages getStage();
+
+private:
+  vex::motor_group &intakeMotors;
+  vex::motor_group &armMotors;
+  AutoClamp &autoClamp;
+  bool (*goalDetected)();
+  MacroStages stage;
+  double intakeVelocity;
+  double stageStartIntakePosition;
+  double stageTimes[NUMBER_OF_STAGES];
+  vex::timer stageTimer;
+  void enterStage(MacroStages newStage);
+  void finish(const char *result);
+};
+
+#endif
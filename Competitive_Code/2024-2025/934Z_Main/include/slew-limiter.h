@@ -0,0 +1,22 @@
+#ifndef SLEW_LIMITER_H
+#define SLEW_LIMITER_H
+
+/**
+ * @brief SlewRateLimiter class limits how fast a drive command may change per control tick
+ * @details See slew-limiter.cpp for full explanation and implementation
+ */
+class SlewRateLimiter
+{
+public:
+  SlewRateLimiter();
+  void setLimits(double newAccelerationLimit, double newDecelerationLimit);
+  double update(double target);
+  void reset(double newOutput);
+
+private:
+  double output;
+  double accelerationLimit;
+  double decelerationLimit;
+};
+
+#endif
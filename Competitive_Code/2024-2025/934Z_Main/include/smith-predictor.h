@@ -0,0 +1,48 @@
+#ifndef SMITH_PREDICTOR_H
+#define SMITH_PREDICTOR_H
+
+/**
+ * @brief SmithPredictor class estimates a loop's dead time and predicts the state a delayed reading has not caught up to
+ * @details See smith-predictor.cpp for full explanation and implementation
+ */
+class SmithPredictor
+{
+public:
+  static const int MAX_DELAY_TICKS = 8;
+
+  SmithPredictor(double newModelGain, double newTimeConstant, double newResponseThreshold);
+  void reset(double measurement);
+  double predict(double measurement);
+  void setCommand(double command);
+  double getPrediction();
+  double getDelay();
+
+private:
+  double modelGain;
+  double timeConstant;
+  double responseThreshold;
+  double modelHistory[MAX_DELAY_TICKS + 1];
+  double measurementHistory[MAX_DELAY_TICKS + 1];
+  int historyIndex;
+  double model;
+  double command;
+  double lastMeasurement;
+  double prediction;
+  double delayTicks;
+  int tick;
+  double tickTime;
+  double lastTime;
+  vex::timer predictorTimer;
+  bool timingStep;
+  int stepTick;
+  double stepDirection;
+  double stepMeasurement;
+  double stepModel;
+  int modelResponseTick;
+  int steadyTick;
+  double steadyCommand;
+  bool rampTimed;
+  bool checkStepResponse(int elapsed, double modelValue, double measurement);
+};
+
+#endif
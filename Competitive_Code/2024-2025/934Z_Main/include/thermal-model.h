@@ -0,0 +1,54 @@
+#ifndef THERMAL_MODEL_H
+#define THERMAL_MODEL_H
+
+#include <string>
+#include <vector>
+
+/**
+ * @brief ThermalModel class predicts each motor's temperature from its current and derates it ahead of the firmware
+ * @details See thermal-model.cpp for full explanation and implementation
+ */
+class ThermalModel
+{
+public:
+  ThermalModel(double newHorizon);
+  void addMotor(vex::motor newMotor, std::string name);
+  void update();
+  double getDerating(vex::motor &motorToCheck);
+  double getPredictedTemperature(vex::motor &motorToCheck);
+  void setLogging(bool newLogging);
+  void printCalibration();
+
+private:
+  struct MotorState
+  {
+    vex::motor thermalMotor;
+    std::string name;
+    bool started;
+    double ambientTemperature;
+    double modelTemperature;
+    double averageCurrentSquared;
+    double predictedTemperature;
+    double derating;
+    double sampleStartTime;
+    double sampleStartTemperature;
+    double sampleCurrentSquared;
+    double sampleRise;
+    int sampleTicks;
+    double fitCurrentCurrent;
+    double fitCurrentRise;
+    double fitRiseRise;
+    double fitCurrentSlope;
+    double fitRiseSlope;
+    int fitSamples;
+  };
+  std::vector<MotorState> motors;
+  double horizon;
+  bool logging;
+  double lastUpdateTime;
+  vex::timer thermalTimer;
+  MotorState *findMotor(vex::motor &motorToCheck);
+  void addCalibrationSample(MotorState &state, double measuredTemperature, double now);
+};
+
+#endif
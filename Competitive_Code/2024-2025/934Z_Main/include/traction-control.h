@@ -0,0 +1,40 @@
+#ifndef TRACTION_CONTROL_H
+#define TRACTION_CONTROL_H
+
+/**
+ * @brief TractionControl class detects drive wheel slip and limits the slipping side's command
+ * @details See traction-control.cpp for full explanation and implementation
+ */
+class TractionControl
+{
+public:
+  TractionControl(vex::motor newLeftFront, vex::motor newLeftBack, vex::motor newRightFront, vex::motor newRightBack, double newTimeConstant, double newTickTime);
+  void apply(double &leftCommand, double &rightCommand);
+  bool isLeftSlipping();
+  bool isRightSlipping();
+  double getLeftPosition();
+  double getRightPosition();
+
+private:
+  vex::motor leftFront;
+  vex::motor leftBack;
+  vex::motor rightFront;
+  vex::motor rightBack;
+  double response;
+  bool leftSlipping;
+  bool rightSlipping;
+  double lastLeftVelocity;
+  double lastRightVelocity;
+  double lastLeftCommand;
+  double lastRightCommand;
+  double leftPosition;
+  double rightPosition;
+  double lastLeftFrontPosition;
+  double lastLeftBackPosition;
+  double lastRightFrontPosition;
+  double lastRightBackPosition;
+  bool checkSide(vex::motor &frontMotor, vex::motor &backMotor, double lastCommand, double &lastVelocity, double &groundVelocity);
+  void updateSidePosition(vex::motor &frontMotor, vex::motor &backMotor, bool slipping, double &lastFrontPosition, double &lastBackPosition, double &sidePosition);
+};
+
+#endif
@@ -0,0 +1,128 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       auto-clamp.cpp                                            */
+/*    Created:      10/18/2026                                                */
+/*    Description:  Mobile goal clamp triggered by a goal-presence sensor     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include "vex.h"
+#include "auto-clamp.h"
+
+using namespace vex;
+
+// Consecutive samples the goal sensor must agree on before the clamp fires (debounce)
+const int CONTACT_SAMPLES = 2;
+// Consecutive samples without a goal before auto-clamping is re-armed after a manual release
+const int CLEAR_SAMPLES = 20;
+
+/**
+ * @brief constructs an AutoClamp around the clamp solenoid and a goal-presence check
+ * @param newClamp VEX pneumatics solenoid that clamps the mobile goal
+ * @param newGoalDetected function returning true while a goal is at the clamp (bumper, limit switch or distance sensor)
+ * @date 10/18/2026
+ */
+AutoClamp::AutoClamp(vex::pneumatics &newClamp, bool (*newGoalDetected)()) : clamp(newClamp), goalDetected(newGoalDetected)
+{
+  autoEnabled = true;
+  clamped = false;
+  lockedOut = false;
+  contactTicks = 0;
+  clearTicks = 0;
+}
+
+/**
+ * @brief samples the goal sensor and clamps the instant a goal is confirmed
+ * @details A goal is confirmed once CONTACT_SAMPLES consecutive samples detect it. The time from the
+ * first contact sample to the clamp firing is printed to the terminal. After the driver releases a goal
+ * manually, auto-clamping stays locked out until the sensor has been clear for CLEAR_SAMPLES samples so
+ * the goal can be dropped without being grabbed again. Should be called every 5 msec.
+ * @relates clampTracking()
+ * @date 10/18/2026
+ */
+void AutoClamp::update()
+{
+  if (!goalDetected())
+  {
+    contactTicks = 0;
+    if (lockedOut && ++clearTicks >= CLEAR_SAMPLES)
+    {
+      lockedOut = false;
+    }
+    return;
+  }
+  clearTicks = 0;
+
+  if (clamped || lockedOut || !autoEnabled)
+  {
+    return;
+  }
+
+  if (contactTicks == 0)
+  {
+    contactTimer.clear();
+  }
+  contactTicks++;
+
+  if (contactTicks >= CONTACT_SAMPLES)
+  {
+    setClamped(true);
+    printf("Auto clamp engaged %.0f msec after goal contact\n", contactTimer.time(vex::timeUnits::msec));
+  }
+}
+
+/**
+ * @brief manual override: toggles the clamp regardless of the goal sensor
+ * @relates usercontrol()
+ * @date 10/18/2026
+ */
+void AutoClamp::toggle()
+{
+  setClamped(!clamped);
+}
+
+/**
+ * @brief sets the clamp; releasing a detected goal locks auto-clamping out until the goal is gone
+ * @param newClamped bool true to clamp, false to release
+ * @date 10/18/2026
+ */
+void AutoClamp::setClamped(bool newClamped)
+{
+  if (clamped && !newClamped)
+  {
+    lockedOut = true;
+    clearTicks = 0;
+  }
+  clamped = newClamped;
+  contactTicks = 0;
+  clamp.set(clamped);
+}
+
+/**
+ * @brief enables or disables automatic clamping; manual toggling works either way
+ * @param newAutoEnabled bool true to clamp automatically on goal contact
+ * @date 10/18/2026
+ */
+void AutoClamp::setAutoEnabled(bool newAutoEnabled)
+{
+  autoEnabled = newAutoEnabled;
+  contactTicks = 0;
+}
+
+/**
+ * @brief returns whether automatic clamping is enabled
+ * @date 10/18/2026
+ */
+bool AutoClamp::isAutoEnabled()
+{
+  return autoEnabled;
+}
+
+/**
+ * @brief returns whether the clamp is currently clamped
+ * @date 10/18/2026
+ */
+bool AutoClamp::isClamped()
+{
+  return clamped;
+}
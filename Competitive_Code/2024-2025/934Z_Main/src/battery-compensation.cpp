@@ -0,0 +1,145 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       battery-compensation.cpp                                  */
+/*    Created:      10/18/2026                                                */
+/*    Description:  Battery sag compensation and internal resistance estimate */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include "vex.h"
+#include "battery-compensation.h"
+
+using namespace vex;
+
+// Volts the V5 motors accept at full command
+const double MOTOR_MAX_VOLTAGE = 12;
+// Fraction per tick (20 msec) the filtered voltage moves toward the reading, about a 200 msec time constant
+const double VOLTAGE_FILTER = 0.1;
+// Largest boost ever applied, so a bad reading cannot double every command
+const double MAX_SCALE = 1.3;
+// Weight kept by older current and voltage pairs each tick, about a 4 second memory
+const double FIT_FORGETTING = 0.995;
+// Amps squared of current variance needed before the internal resistance fit is trusted
+const double MIN_CURRENT_VARIANCE = 0.5;
+// Ohms assumed for a healthy V5 battery and its wiring until the fit has enough spread to go on
+const double DEFAULT_INTERNAL_RESISTANCE = 0.1;
+
+/**
+ * @brief constructs a BatteryCompensation
+ * @param newBattery VEX V5 Brain battery to sample
+ * @param newNominalVoltage double loaded battery volts the robot's routes and gains were tuned at
+ * @date 10/18/2026
+ */
+BatteryCompensation::BatteryCompensation(vex::brain::battery &newBattery, double newNominalVoltage) : battery(newBattery)
+{
+  nominalVoltage = newNominalVoltage;
+  started = false;
+  filteredVoltage = newNominalVoltage;
+  scale = 1;
+  fitWeight = 0;
+  fitCurrent = 0;
+  fitVoltage = 0;
+  fitCurrentCurrent = 0;
+  fitCurrentVoltage = 0;
+  internalResistance = DEFAULT_INTERNAL_RESISTANCE;
+  openCircuitVoltage = newNominalVoltage;
+}
+
+/**
+ * @brief samples the battery and refreshes the compensation scale and internal resistance estimate
+ * @details The loaded battery voltage is low-pass filtered so motor current spikes do not jitter every
+ * command, and the scale is nominal over filtered voltage, capped at MAX_SCALE. Each current and voltage
+ * pair also feeds an exponentially forgetting least squares fit of voltage = openCircuit - resistance *
+ * current; the fit is only used once the current has varied enough to separate the two.
+ * Must be called every control tick (20 msec).
+ * @relates currentBudgetTracking()
+ * @date 10/18/2026
+ */
+void BatteryCompensation::update()
+{
+  double voltage = battery.voltage(vex::voltageUnits::volt);
+  double current = battery.current(vex::currentUnits::amp);
+  if (voltage <= 0)
+  {
+    return;
+  }
+
+  if (!started)
+  {
+    started = true;
+    filteredVoltage = voltage;
+  }
+  filteredVoltage += (voltage - filteredVoltage) * VOLTAGE_FILTER;
+  scale = fmin(nominalVoltage / filteredVoltage, MAX_SCALE);
+
+  fitWeight = fitWeight * FIT_FORGETTING + 1;
+  fitCurrent = fitCurrent * FIT_FORGETTING + current;
+  fitVoltage = fitVoltage * FIT_FORGETTING + voltage;
+  fitCurrentCurrent = fitCurrentCurrent * FIT_FORGETTING + current * current;
+  fitCurrentVoltage = fitCurrentVoltage * FIT_FORGETTING + current * voltage;
+
+  double meanCurrent = fitCurrent / fitWeight;
+  double meanVoltage = fitVoltage / fitWeight;
+  double currentVariance = fitCurrentCurrent / fitWeight - meanCurrent * meanCurrent;
+  if (currentVariance > MIN_CURRENT_VARIANCE)
+  {
+    double covariance = fitCurrentVoltage / fitWeight - meanCurrent * meanVoltage;
+    double resistance = -covariance / currentVariance;
+    if (resistance > 0)
+    {
+      internalResistance = resistance;
+    }
+  }
+  openCircuitVoltage = meanVoltage + internalResistance * meanCurrent;
+}
+
+/**
+ * @brief converts a percent command into the volts that give the same motor voltage at nominal charge
+ * @details A fresh battery has its commands trimmed and a tired one boosted, so the same percent drives
+ * the same speed until the boost runs into MOTOR_MAX_VOLTAGE.
+ * @relates usercontrol()
+ * @param percent double command from -100 to 100
+ * @returns double compensated volts from -MOTOR_MAX_VOLTAGE to MOTOR_MAX_VOLTAGE
+ * @date 10/18/2026
+ */
+double BatteryCompensation::toVolts(double percent)
+{
+  double volts = percent / 100.0 * MOTOR_MAX_VOLTAGE * scale;
+  return fmin(fmax(volts, -MOTOR_MAX_VOLTAGE), MOTOR_MAX_VOLTAGE);
+}
+
+/**
+ * @brief returns the factor voltage commands are currently multiplied by
+ * @date 10/18/2026
+ */
+double BatteryCompensation::getScale()
+{
+  return scale;
+}
+
+/**
+ * @brief returns the filtered loaded battery voltage in volts
+ * @date 10/18/2026
+ */
+double BatteryCompensation::getFilteredVoltage()
+{
+  return filteredVoltage;
+}
+
+/**
+ * @brief returns the estimated internal resistance of the battery and its wiring in ohms
+ * @date 10/18/2026
+ */
+double BatteryCompensation::getInternalResistance()
+{
+  return internalResistance;
+}
+
+/**
+ * @brief returns the estimated unloaded battery voltage in volts
+ * @date 10/18/2026
+ */
+double BatteryCompensation::getOpenCircuitVoltage()
+{
+  return openCircuitVoltage;
+}
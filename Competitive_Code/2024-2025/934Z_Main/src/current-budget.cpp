@@ -0,0 +1,212 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       current-budget.cpp                                        */
+/*    Created:      10/18/2026                                                */
+/*    Description:  Priority based current limits shared across all motors    */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include "vex.h"
+#include "thermal-model.h"
+#include "current-budget.h"
+
+using namespace vex;
+
+// Amps a V5 motor may draw with no limit applied
+const double MOTOR_MAX_CURRENT = 2.5;
+// Amps every installed motor keeps however tight the budget is, so no subsystem goes fully limp
+const double MOTOR_MIN_CURRENT = 0.5;
+// Amps above its present draw a motor is given room to grow into before it is considered limited
+const double DEMAND_HEADROOM = 0.5;
+// Amps within its limit at which a motor is treated as pinned and asking for the full MOTOR_MAX_CURRENT
+const double LIMIT_MARGIN = 0.2;
+// Amps a motor's limit must move before it is re-sent, to keep the smart ports quiet
+const double LIMIT_UPDATE_STEP = 0.1;
+
+/**
+ * @brief constructs a CurrentBudget with no subsystems
+ * @param newTotalBudget double amps the whole robot may draw across every registered motor
+ * @date 10/18/2026
+ */
+CurrentBudget::CurrentBudget(double newTotalBudget)
+{
+  totalBudget = newTotalBudget;
+  throttleEvents = 0;
+  thermalModel = NULL;
+}
+
+/**
+ * @brief caps each motor's share at what its thermal model allows
+ * @relates pre_auton()
+ * @param newThermalModel ThermalModel pointer whose derating scales MOTOR_MAX_CURRENT per motor, or NULL for none
+ * @date 10/18/2026
+ */
+void CurrentBudget::setThermalModel(ThermalModel *newThermalModel)
+{
+  thermalModel = newThermalModel;
+}
+
+/**
+ * @brief registers a subsystem whose motors share in the budget
+ * @details Subsystems are kept sorted by priority, lowest number first, and equal priorities keep the
+ * order they were added in. Every motor starts at MOTOR_MAX_CURRENT.
+ * @relates pre_auton()
+ * @param name std::string name used when logging throttling
+ * @param priority int order the subsystem is served in, 0 being served first
+ * @param motors std::vector of VEX V5 motors in the subsystem
+ * @date 10/18/2026
+ */
+void CurrentBudget::addSubsystem(std::string name, int priority, std::vector<vex::motor> motors)
+{
+  Subsystem newSubsystem;
+  newSubsystem.name = name;
+  newSubsystem.priority = priority;
+  newSubsystem.motors = motors;
+  newSubsystem.motorLimit = MOTOR_MAX_CURRENT;
+  newSubsystem.motorLimits = std::vector<double>(motors.size(), MOTOR_MAX_CURRENT);
+  newSubsystem.throttled = false;
+  newSubsystem.throttleStartTime = 0;
+  for (int i = 0; i < newSubsystem.motors.size(); i++)
+  {
+    newSubsystem.motors[i].setMaxTorque(MOTOR_MAX_CURRENT, vex::currentUnits::amp);
+  }
+
+  std::vector<Subsystem>::iterator position = subsystems.begin();
+  while (position != subsystems.end() && position->priority <= priority)
+  {
+    position++;
+  }
+  subsystems.insert(position, newSubsystem);
+}
+
+/**
+ * @brief reads every motor's current and hands out this tick's current limits by priority
+ * @details Each installed motor first has MOTOR_MIN_CURRENT set aside. The rest of the budget is then
+ * offered to the subsystems in priority order: a motor asks for its present draw plus DEMAND_HEADROOM, or
+ * for MOTOR_MAX_CURRENT if it is already pinned at its limit. A subsystem that cannot get all it asks for
+ * has its motors' limits lowered and is logged as throttled until its demand is met again. With a
+ * ThermalModel set, a motor predicted to overheat is also capped below MOTOR_MAX_CURRENT, and asks for
+ * no more than that cap.
+ * Must be called every control tick (20 msec).
+ * @relates currentBudgetTracking()
+ * @date 10/18/2026
+ */
+void CurrentBudget::update()
+{
+  double available = totalBudget;
+  for (int i = 0; i < subsystems.size(); i++)
+  {
+    for (int j = 0; j < subsystems[i].motors.size(); j++)
+    {
+      if (subsystems[i].motors[j].installed())
+      {
+        available -= MOTOR_MIN_CURRENT;
+      }
+    }
+  }
+
+  for (int i = 0; i < subsystems.size(); i++)
+  {
+    Subsystem &subsystem = subsystems[i];
+    int installedMotors = 0;
+    double demand = 0;
+    std::vector<double> ceilings(subsystem.motors.size(), MOTOR_MAX_CURRENT);
+    for (int j = 0; j < subsystem.motors.size(); j++)
+    {
+      if (!subsystem.motors[j].installed())
+      {
+        continue;
+      }
+      if (thermalModel != NULL)
+      {
+        ceilings[j] = fmax(MOTOR_MAX_CURRENT * thermalModel->getDerating(subsystem.motors[j]), MOTOR_MIN_CURRENT);
+      }
+      double current = subsystem.motors[j].current(vex::currentUnits::amp);
+      double motorDemand = current >= subsystem.motorLimits[j] - LIMIT_MARGIN ? ceilings[j] : current + DEMAND_HEADROOM;
+      demand += fmin(fmax(motorDemand, MOTOR_MIN_CURRENT), ceilings[j]) - MOTOR_MIN_CURRENT;
+      installedMotors++;
+    }
+    if (installedMotors == 0)
+    {
+      continue;
+    }
+
+    // Share whatever the subsystem is granted evenly across its motors, never below MOTOR_MIN_CURRENT
+    double granted = fmax(fmin(demand, available), 0);
+    available -= granted;
+    bool throttled = granted < demand;
+    double share = throttled ? MOTOR_MIN_CURRENT + granted / installedMotors : MOTOR_MAX_CURRENT;
+
+    for (int j = 0; j < subsystem.motors.size(); j++)
+    {
+      double motorLimit = fmin(share, ceilings[j]);
+      if (fabs(motorLimit - subsystem.motorLimits[j]) >= LIMIT_UPDATE_STEP || (motorLimit == MOTOR_MAX_CURRENT && subsystem.motorLimits[j] != MOTOR_MAX_CURRENT))
+      {
+        subsystem.motorLimits[j] = motorLimit;
+        subsystem.motors[j].setMaxTorque(motorLimit, vex::currentUnits::amp);
+      }
+    }
+    subsystem.motorLimit = share;
+
+    if (throttled && !subsystem.throttled)
+    {
+      throttleEvents++;
+      subsystem.throttleStartTime = budgetTimer.time(vex::timeUnits::msec);
+      printf("Current budget: throttling %s to %.2f A per motor (asked %.2f A, %.2f A left)\n", subsystem.name.c_str(), subsystem.motorLimit, demand + installedMotors * MOTOR_MIN_CURRENT, granted + installedMotors * MOTOR_MIN_CURRENT);
+    }
+    else if (!throttled && subsystem.throttled)
+    {
+      printf("Current budget: %s released after %.0f msec\n", subsystem.name.c_str(), budgetTimer.time(vex::timeUnits::msec) - subsystem.throttleStartTime);
+    }
+    subsystem.throttled = throttled;
+  }
+}
+
+/**
+ * @brief finds a registered subsystem by name
+ * @param name std::string name given to addSubsystem()
+ * @returns Subsystem pointer, or NULL if no subsystem has that name
+ * @date 10/18/2026
+ */
+CurrentBudget::Subsystem *CurrentBudget::findSubsystem(std::string name)
+{
+  for (int i = 0; i < subsystems.size(); i++)
+  {
+    if (subsystems[i].name == name)
+    {
+      return &subsystems[i];
+    }
+  }
+  return NULL;
+}
+
+/**
+ * @brief returns whether the named subsystem was throttled at the last update()
+ * @param name std::string name given to addSubsystem()
+ * @date 10/18/2026
+ */
+bool CurrentBudget::isThrottled(std::string name)
+{
+  Subsystem *subsystem = findSubsystem(name);
+  return subsystem != NULL && subsystem->throttled;
+}
+
+/**
+ * @brief returns the per-motor share of the budget in amps last given to the named subsystem
+ * @param name std::string name given to addSubsystem()
+ * @date 10/18/2026
+ */
+double CurrentBudget::getMotorLimit(std::string name)
+{
+  Subsystem *subsystem = findSubsystem(name);
+  return subsystem == NULL ? MOTOR_MAX_CURRENT : subsystem->motorLimit;
+}
+
+/**
+ * @brief returns the number of times any subsystem has been throttled since the program started
+ * @date 10/18/2026
+ */
+int CurrentBudget::getThrottleEvents()
+{
+  return throttleEvents;
+}
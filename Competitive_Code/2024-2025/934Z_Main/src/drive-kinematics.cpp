@@ -0,0 +1,190 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       drive-kinematics.cpp                                      */
+/*    Created:      10/18/2026                                                */
+/*    Description:  Tank drive kinematics for any subset of working motors    */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include "vex.h"
+#include "battery-compensation.h"
+#include "drive-kinematics.h"
+
+using namespace vex;
+
+// Fraction of top speed given up as the weaker side goes from two motors to none, leaving its remaining
+// motor the torque headroom to keep pace with the other side
+const double DEGRADED_SPEED_DROP = 0.5;
+// Motors on each side of the drive when all of them work
+const int MOTORS_PER_SIDE = 2;
+// Motor degrees per second at full speed with the drive's 200 rpm green cartridges
+const double DRIVE_MAX_VELOCITY = 1200;
+// Multiple of a move's expected time, plus milliseconds to get moving, before a move is given up on
+const double MOVE_TIMEOUT_FACTOR = 2;
+const double MOVE_TIMEOUT_MARGIN = 500;
+
+/**
+ * @brief constructs DriveKinematics for the four drive motors, assuming all of them work until update()
+ * @param newBatteryCompensation BatteryCompensation that turns spin() commands into volts
+ * @date 10/18/2026
+ */
+DriveKinematics::DriveKinematics(vex::motor newLeftFront, vex::motor newLeftBack, vex::motor newRightFront, vex::motor newRightBack, BatteryCompensation &newBatteryCompensation)
+    : wheels{newLeftFront, newLeftBack, newRightFront, newRightBack}, batteryCompensation(newBatteryCompensation)
+{
+  for (int i = 0; i < NUMBER_OF_WHEELS; i++)
+  {
+    gains[i] = 1;
+  }
+  speedLimit = 1;
+  workingMotors = NUMBER_OF_WHEELS;
+}
+
+/**
+ * @brief returns whether a wheel index is on the left side of the drive
+ * @param wheel int index from the Wheels enum
+ * @date 10/18/2026
+ */
+bool DriveKinematics::isLeftWheel(int wheel)
+{
+  return wheel == LEFT_FRONT || wheel == LEFT_BACK;
+}
+
+/**
+ * @brief recomputes each motor's gain from which drive motors are connected
+ * @details A side's command only ever goes to motors on that side, so any subset of working motors keeps
+ * tank steering. The weaker side sets the speed limit: it drops by DEGRADED_SPEED_DROP times the fraction
+ * of that side's motors that are lost, so with one motor left on a side the robot runs at 75% and that
+ * motor has the torque to match the other side instead of falling behind it. Working motors carry the
+ * speed limit as their gain and lost motors a gain of 0. Changes are logged once.
+ * @relates spin(), spinFor(), RoutePlayer::update()
+ * @date 10/18/2026
+ */
+void DriveKinematics::update()
+{
+  int leftMotors = 0;
+  int rightMotors = 0;
+  bool working[NUMBER_OF_WHEELS];
+  for (int i = 0; i < NUMBER_OF_WHEELS; i++)
+  {
+    working[i] = wheels[i].installed();
+    if (working[i] && isLeftWheel(i))
+    {
+      leftMotors++;
+    }
+    else if (working[i])
+    {
+      rightMotors++;
+    }
+  }
+
+  int weakerSide = leftMotors < rightMotors ? leftMotors : rightMotors;
+  double newSpeedLimit = 1 - DEGRADED_SPEED_DROP * (MOTORS_PER_SIDE - weakerSide) / MOTORS_PER_SIDE;
+  for (int i = 0; i < NUMBER_OF_WHEELS; i++)
+  {
+    gains[i] = working[i] ? newSpeedLimit : 0;
+  }
+
+  if (leftMotors + rightMotors != workingMotors || newSpeedLimit != speedLimit)
+  {
+    printf("Drive kinematics: %d left and %d right motors working, speed limit %.0f%%\n", leftMotors, rightMotors, newSpeedLimit * 100);
+  }
+  workingMotors = leftMotors + rightMotors;
+  speedLimit = newSpeedLimit;
+}
+
+/**
+ * @brief drives each working motor with its own side's command, scaled by its gain
+ * @relates usercontrol()
+ * @param leftCommand double percent command for the left side
+ * @param rightCommand double percent command for the right side
+ * @date 10/18/2026
+ */
+void DriveKinematics::spin(double leftCommand, double rightCommand)
+{
+  update();
+  for (int i = 0; i < NUMBER_OF_WHEELS; i++)
+  {
+    if (gains[i] > 0)
+    {
+      double command = (isLeftWheel(i) ? leftCommand : rightCommand) * gains[i];
+      wheels[i].spin(vex::directionType::fwd, batteryCompensation.toVolts(command), vex::voltageUnits::volt);
+    }
+  }
+}
+
+/**
+ * @brief open-loop relative move of each side, slowed by the speed limit, that waits for every working motor
+ * @details Only working motors are commanded and waited on, so a lost motor can no longer end the move
+ * early or leave it hanging. A motor that unplugs mid-move stops being waited on, and the whole move is
+ * given up on after MOVE_TIMEOUT_FACTOR times its expected time at the commanded velocity plus
+ * MOVE_TIMEOUT_MARGIN, stopping the drive, so a stalled motor cannot hang autonomous. The drive's motors
+ * are checked again once the move ends.
+ * @relates drive(), turn()
+ * @param leftDegrees double motor degrees for the left side to turn
+ * @param rightDegrees double motor degrees for the right side to turn
+ * @param velocity double percent velocity requested with every motor working
+ * @date 10/18/2026
+ */
+void DriveKinematics::spinFor(double leftDegrees, double rightDegrees, double velocity)
+{
+  update();
+  for (int i = 0; i < NUMBER_OF_WHEELS; i++)
+  {
+    if (gains[i] > 0)
+    {
+      wheels[i].spinFor(vex::directionType::fwd, isLeftWheel(i) ? leftDegrees : rightDegrees, vex::rotationUnits::deg, velocity * gains[i], vex::velocityUnits::pct, false);
+    }
+  }
+
+  double moveVelocity = DRIVE_MAX_VELOCITY * fabs(velocity) * speedLimit / 100;
+  double timeout = MOVE_TIMEOUT_MARGIN;
+  if (moveVelocity > 0)
+  {
+    timeout += MOVE_TIMEOUT_FACTOR * fmax(fabs(leftDegrees), fabs(rightDegrees)) / moveVelocity * 1000;
+  }
+  vex::timer moveTimer;
+  for (int i = 0; i < NUMBER_OF_WHEELS; i++)
+  {
+    while (gains[i] > 0 && !wheels[i].isDone() && wheels[i].installed() && moveTimer.time(vex::timeUnits::msec) < timeout)
+    {
+      wait(10, msec);
+    }
+  }
+  if (moveTimer.time(vex::timeUnits::msec) >= timeout)
+  {
+    printf("Drive kinematics: move timed out after %.0f msec\n", timeout);
+    for (int i = 0; i < NUMBER_OF_WHEELS; i++)
+    {
+      wheels[i].stop();
+    }
+  }
+  update();
+}
+
+/**
+ * @brief returns the gain applied to a wheel's side command, 0 if its motor is lost
+ * @param wheel int index from the Wheels enum
+ * @date 10/18/2026
+ */
+double DriveKinematics::getGain(int wheel)
+{
+  return gains[wheel];
+}
+
+/**
+ * @brief returns the fraction of top speed the drive is limited to with its working motors
+ * @date 10/18/2026
+ */
+double DriveKinematics::getSpeedLimit()
+{
+  return speedLimit;
+}
+
+/**
+ * @brief returns the number of drive motors connected at the last update()
+ * @date 10/18/2026
+ */
+int DriveKinematics::getWorkingMotors()
+{
+  return workingMotors;
+}
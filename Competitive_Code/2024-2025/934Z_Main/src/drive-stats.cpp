@@ -0,0 +1,102 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       drive-stats.cpp                                           */
+/*    Created:      10/18/2026                                                */
+/*    Description:  Drive current and wheel slip measurement                  */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include "vex.h"
+#include "drive-stats.h"
+
+using namespace vex;
+
+/**
+ * @brief constructs DriveStats for the four drive motors
+ * @param newTractionControl TractionControl whose slip detection the slip events are counted from
+ * @date 10/18/2026
+ */
+DriveStats::DriveStats(vex::motor newLeftFront, vex::motor newLeftBack, vex::motor newRightFront, vex::motor newRightBack, TractionControl &newTractionControl)
+    : leftFront(newLeftFront), leftBack(newLeftBack), rightFront(newRightFront), rightBack(newRightBack), tractionControl(newTractionControl)
+{
+  reset();
+}
+
+/**
+ * @brief checks one side of the drive for a new slip event
+ * @details Slip is read from TractionControl, so the stats count exactly the slip the drive acted on and
+ * the detection thresholds live only in traction-control.cpp. Only the start of a slip is counted.
+ * @param slippingNow bool whether TractionControl found the side slipping this tick
+ * @param slipping bool tracking whether the side was already slipping last tick
+ * @returns bool true if a new slip started this tick
+ * @date 10/18/2026
+ */
+bool DriveStats::checkSlip(bool slippingNow, bool &slipping)
+{
+  bool newSlip = slippingNow && !slipping;
+  slipping = slippingNow;
+  return newSlip;
+}
+
+/**
+ * @brief samples the drive motors; call once every control tick, after TractionControl::apply()
+ * @relates usercontrol()
+ * @date 10/18/2026
+ */
+void DriveStats::update()
+{
+  double totalCurrent = leftFront.current(vex::currentUnits::amp) + leftBack.current(vex::currentUnits::amp) +
+                        rightFront.current(vex::currentUnits::amp) + rightBack.current(vex::currentUnits::amp);
+  if (totalCurrent > peakCurrent)
+  {
+    peakCurrent = totalCurrent;
+  }
+  if (checkSlip(tractionControl.isLeftSlipping(), leftSlipping))
+  {
+    slipEvents++;
+  }
+  if (checkSlip(tractionControl.isRightSlipping(), rightSlipping))
+  {
+    slipEvents++;
+  }
+}
+
+/**
+ * @brief prints the peak total drive current and slip count to the terminal
+ * @param label std::string printed before the measurements, e.g. which drive mode they cover
+ * @date 10/18/2026
+ */
+void DriveStats::print(std::string label)
+{
+  printf("%s: peak drive current %.2f A, %d slip events\n", label.c_str(), peakCurrent, slipEvents);
+}
+
+/**
+ * @brief clears the measurements to start a new comparison
+ * @date 10/18/2026
+ */
+void DriveStats::reset()
+{
+  peakCurrent = 0;
+  slipEvents = 0;
+  leftSlipping = false;
+  rightSlipping = false;
+}
+
+/**
+ * @brief returns the highest total drive current seen since the last reset in amps
+ * @date 10/18/2026
+ */
+double DriveStats::getPeakCurrent()
+{
+  return peakCurrent;
+}
+
+/**
+ * @brief returns the number of slip events since the last reset
+ * @date 10/18/2026
+ */
+int DriveStats::getSlipEvents()
+{
+  return slipEvents;
+}
@@ -0,0 +1,134 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       heading-hold.cpp                                          */
+/*    Created:      10/18/2026                                                */
+/*    Description:  Inertial heading hold for straight tank driving           */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include "vex.h"
+#include "heading-hold.h"
+
+using namespace vex;
+
+// Percent the two sticks may differ by and still count as a straight push
+const double HOLD_STICK_DIFFERENCE = 5;
+// Percent average stick below which the robot is treated as stopped and nothing is held
+const double HOLD_MIN_SPEED = 10;
+// Degrees per tick the robot may still be turning when the heading is captured, so the end of a turn is not undone
+const double HOLD_CAPTURE_RATE = 0.4;
+// Percent of side difference per degree of heading error
+const double HEADING_KP = 2.0;
+// Percent per degree-tick of accumulated heading error, which trims out a steady side mismatch
+const double HEADING_KI = 0.05;
+// Percent per degree per tick of turning, which damps the correction
+const double HEADING_KD = 4.0;
+// Largest percent the integral term may contribute, so it cannot wind up while a wheel is blocked
+const double HEADING_INTEGRAL_LIMIT = 10;
+// Largest percent correction added to one side and taken from the other, small enough that the driver always wins
+const double HEADING_MAX_CORRECTION = 15;
+
+/**
+ * @brief constructs HeadingHold on an inertial sensor, released until the driver pushes straight
+ * @date 10/18/2026
+ */
+HeadingHold::HeadingHold(vex::inertial newSensor)
+    : sensor(newSensor)
+{
+  holding = false;
+  captured = false;
+  targetRotation = 0;
+  lastRotation = 0;
+  integral = 0;
+  headingError = 0;
+}
+
+/**
+ * @brief drops the held heading, so the next straight push captures a new one
+ * @date 10/18/2026
+ */
+void HeadingHold::release()
+{
+  holding = false;
+  captured = false;
+  integral = 0;
+  headingError = 0;
+}
+
+/**
+ * @brief corrects both sides' commands toward the held heading while the sticks push straight
+ * @details Holding starts when the sticks differ by no more than HOLD_STICK_DIFFERENCE and average at least
+ * HOLD_MIN_SPEED, and ends on the first tick they do not, so a turn is never fought. While the robot is still
+ * turning faster than HOLD_CAPTURE_RATE from the last turn the target follows it; the heading is captured
+ * once it settles. From then on a PID on the inertial rotation, which does not wrap, adds its correction to
+ * the left side and takes it from the right, since rotation grows clockwise. The derivative is taken on the
+ * measured rotation so capturing a target never kicks the robot. A side pushed past 100% scales both down
+ * rather than losing the correction. Without a working, calibrated sensor
+ * the commands pass through unchanged.
+ * @relates usercontrol()
+ * @param leftCommand double percent command for the left side, corrected in place
+ * @param rightCommand double percent command for the right side, corrected in place
+ * @date 10/18/2026
+ */
+void HeadingHold::apply(double &leftCommand, double &rightCommand)
+{
+  if (!sensor.installed() || sensor.isCalibrating())
+  {
+    release();
+    return;
+  }
+
+  double rotation = sensor.rotation(vex::rotationUnits::deg);
+  double turnRate = rotation - lastRotation;
+  lastRotation = rotation;
+
+  double average = (leftCommand + rightCommand) / 2;
+  if (fabs(leftCommand - rightCommand) > HOLD_STICK_DIFFERENCE || fabs(average) < HOLD_MIN_SPEED)
+  {
+    release();
+    return;
+  }
+  holding = true;
+
+  if (!captured)
+  {
+    targetRotation = rotation;
+    captured = fabs(turnRate) < HOLD_CAPTURE_RATE;
+    return;
+  }
+
+  headingError = targetRotation - rotation;
+  integral += HEADING_KI * headingError;
+  integral = fmin(fmax(integral, -HEADING_INTEGRAL_LIMIT), HEADING_INTEGRAL_LIMIT);
+  double correction = HEADING_KP * headingError + integral - HEADING_KD * turnRate;
+  correction = fmin(fmax(correction, -HEADING_MAX_CORRECTION), HEADING_MAX_CORRECTION);
+
+  leftCommand += correction;
+  rightCommand -= correction;
+
+  // At full stick the faster side cannot speed up, so both are scaled down to keep the correction's ratio
+  double largest = fmax(fabs(leftCommand), fabs(rightCommand));
+  if (largest > 100)
+  {
+    leftCommand *= 100 / largest;
+    rightCommand *= 100 / largest;
+  }
+}
+
+/**
+ * @brief returns whether the sticks are pushing straight and the heading is being held
+ * @date 10/18/2026
+ */
+bool HeadingHold::isHolding()
+{
+  return holding;
+}
+
+/**
+ * @brief returns the degrees from the held heading at the last apply(), positive when the robot is left of it
+ * @date 10/18/2026
+ */
+double HeadingHold::getHeadingError()
+{
+  return headingError;
+}
@@ -0,0 +1,121 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       jam-detector.cpp                                          */
+/*    Created:      10/18/2026                                                */
+/*    Description:  Intake jam detection with automatic reverse-and-retry     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include "vex.h"
+#include "jam-detector.h"
+
+using namespace vex;
+
+// Amps above which a commanded intake motor is considered loaded
+const double JAM_CURRENT = 2.0;
+// Percent velocity below which a loaded intake motor is considered stalled
+const double JAM_VELOCITY = 5.0;
+// Consecutive stalled ticks (20 msec each) before a jam is flagged
+const int JAM_TICKS = 3;
+// Ticks after a new command during which spin-up current is ignored
+const int SPIN_UP_TICKS = 5;
+// Milliseconds the intake motor is reversed for to clear a jam
+const double CLEAR_TIME = 150;
+
+/**
+ * @brief constructs a JamDetector for one intake motor
+ * @param newIntakeMotor VEX V5 motor driven by this JamDetector
+ * @param newMotorName std::string name of newIntakeMotor used when logging jams
+ * @date 10/18/2026
+ */
+JamDetector::JamDetector(vex::motor newIntakeMotor, std::string newMotorName) : intakeMotor(newIntakeMotor), motorName(newMotorName)
+{
+  lastCommandedVelocity = 0;
+  spinUpTicks = 0;
+  stalledTicks = 0;
+  clearing = false;
+  jamCount = 0;
+}
+
+/**
+ * @brief drives the intake motor at the commanded velocity, reversing briefly to clear jams
+ * @details A jam is flagged when the motor draws more than JAM_CURRENT while turning slower than
+ * JAM_VELOCITY for JAM_TICKS consecutive ticks. The motor is then reversed for CLEAR_TIME msec
+ * before the commanded velocity resumes. Must be called every control tick in place of spin/stop.
+ * @relates usercontrol()
+ * @param commandedVelocity double percent velocity requested by the driver (negative to outtake, 0 to stop)
+ * @date 10/18/2026
+ */
+void JamDetector::update(double commandedVelocity)
+{
+  // A new command restarts spin-up and cancels any reverse pulse
+  if (commandedVelocity != lastCommandedVelocity)
+  {
+    lastCommandedVelocity = commandedVelocity;
+    spinUpTicks = 0;
+    stalledTicks = 0;
+    clearing = false;
+  }
+
+  if (commandedVelocity == 0)
+  {
+    intakeMotor.stop();
+    return;
+  }
+
+  if (clearing)
+  {
+    if (clearTimer.time(vex::timeUnits::msec) < CLEAR_TIME)
+    {
+      intakeMotor.spin(vex::directionType::fwd, -commandedVelocity, vex::velocityUnits::pct);
+      return;
+    }
+    clearing = false;
+    spinUpTicks = 0;
+  }
+
+  intakeMotor.spin(vex::directionType::fwd, commandedVelocity, vex::velocityUnits::pct);
+
+  if (spinUpTicks < SPIN_UP_TICKS)
+  {
+    spinUpTicks++;
+    return;
+  }
+
+  if (intakeMotor.current(vex::currentUnits::amp) > JAM_CURRENT && fabs(intakeMotor.velocity(vex::velocityUnits::pct)) < JAM_VELOCITY)
+  {
+    stalledTicks++;
+  }
+  else
+  {
+    stalledTicks = 0;
+  }
+
+  if (stalledTicks >= JAM_TICKS)
+  {
+    jamCount++;
+    stalledTicks = 0;
+    clearing = true;
+    clearTimer.clear();
+    printf("Intake jam %d on %s, reversing for %.0f msec\n", jamCount, motorName.c_str(), CLEAR_TIME);
+    intakeMotor.spin(vex::directionType::fwd, -commandedVelocity, vex::velocityUnits::pct);
+  }
+}
+
+/**
+ * @brief returns whether the intake motor is currently reversing to clear a jam
+ * @date 10/18/2026
+ */
+bool JamDetector::isClearing()
+{
+  return clearing;
+}
+
+/**
+ * @brief returns the number of jams detected since the program started
+ * @date 10/18/2026
+ */
+int JamDetector::getJamCount()
+{
+  return jamCount;
+}
@@ -8,6 +8,26 @@
 /*----------------------------------------------------------------------------*/
 
 #include "vex.h"
+#include "jam-detector.h"
+#include "auto-clamp.h"
+#include "scoring-macro.h"
+#include "slew-limiter.h"
+#include "drive-stats.h"
+#include "joystick-curves.h"
+#include "traction-control.h"
+#include "thermal-model.h"
+#include "current-budget.h"
+#include "battery-compensation.h"
+#include "drive-kinematics.h"
+#include "smith-predictor.h"
+#include "mpc-drive.h"
+#include "heading-hold.h"
+#include "route-recorder.h"
+#include "route-sources.h"
+#include "route-player.h"
+#include "route-mirror.h"
+#include "route-library.h"
+#include "route-tables.h"
 #include <string>
 #include <vector>
 #include <algorithm>
@@ -41,14 +61,51 @@ using namespace vex;
 /*      specified.                                                                    */
 /*  - bumper bumperName - represents a VEX bumper constructed with a specified        */
 /*      triport port.                                                                 */
+/*  - inertial inertialSensor - represents the VEX V5 Inertial Sensor constructed     */
+/*      with a PORT; its rotation is the robot's unwrapped heading.                   */
 /*  Non-VEX Declarations:                                                             */
-/*  - int autonSelector - integer representing the autonomous program that the user   */
+/*  - int autonSelector - index in autonRoutes of the autonomous route that the user  */
 /*      selects to run.                                                               */
 /*  - std::map<std::string, int> autonSelectorFrame - map representing the            */
 /*      coordinates of the autonomous selector GUI button on the brain.               */
 /*  Non-VEX Initializations:                                                          */
 /*  - bool waitingForUserInput = false - boolean representing whether the user has    */
 /*      provided input confirming the autonomous program to be run.                   */
+/*  - JamDetector intakeJamDetectorName - drives one intake motor and reverses it     */
+/*      briefly when a jam is detected (see jam-detector.cpp).                        */
+/*  - SlewRateLimiter sideDriveSlew - limits how fast each drive side's command may   */
+/*      change per tick, with limits from driveSlewLimits[driveConfig].               */
+/*  - DriveStats driveStats - measures peak drive current and wheel slip events.      */
+/*  - TractionControl tractionControl - limits a slipping drive side to the speed    */
+/*      its wheels can grip at (see traction-control.cpp).                            */
+/*  - CurrentBudget currentBudget - shares TOTAL_CURRENT_BUDGET between the drive,    */
+/*      arm and intake by priority so peak loads do not brown out (see               */
+/*      current-budget.cpp).                                                          */
+/*  - ThermalModel thermalModel - predicts each motor's temperature THERMAL_HORIZON   */
+/*      seconds ahead and derates its share of currentBudget before it overheats     */
+/*      (see thermal-model.cpp).                                                      */
+/*  - BatteryCompensation batteryCompensation - scales drive voltages by nominal over */
+/*      measured battery voltage (see battery-compensation.cpp).                      */
+/*  - DriveKinematics driveKinematics - drives whichever drive motors still work,     */
+/*      each from its own side's stick, slowed to what the weaker side can keep up    */
+/*      with (see drive-kinematics.cpp).                                              */
+/*  - SmithPredictor sideDrivePredictor - learns each drive side's sensor and         */
+/*      actuator dead time and predicts its true velocity (see smith-predictor.cpp).  */
+/*  - MpcDrive sideDriveMpc - plans each drive side's voltage over a short horizon    */
+/*      within its voltage, acceleration and current limits (see mpc-drive.cpp).     */
+/*  - HeadingHold headingHold - holds the robot's heading on inertialSensor while   */
+/*      both sticks push together (see heading-hold.cpp).                             */
+/*  - RouteRecorder routeRecorder - records every motor and the clamp during driver   */
+/*      control to a binary route file on the SD card (see route-recorder.cpp).       */
+/*  - RoutePlayer routePlayer - replays a recorded route on every motor, smoothly     */
+/*      interpolated and drift corrected each tick, and fires its clamp events        */
+/*      (see route-player.cpp).                                                       */
+/*  - RouteLibrary routeLibrary - the autonomous routes in autonRoutes with their     */
+/*      name, alliance, start pose, duration and checksum; a route is only read once  */
+/*      it is selected (see route-library.cpp).                                       */
+/*  - DriverProfile driverProfiles[] - named joystick response curves built at       */
+/*      compile time, each with or without heading hold; driverProfile is the index  */
+/*      of the one in use.                                                            */
 /*------------------------------------------------------------------------------------*/
 
 // VEX Declarations
@@ -76,6 +133,8 @@ triport myTriport = triport(Brain.ThreeWirePort);
 pneumatics clamp = pneumatics(myTriport.A);
 bumper autonSelectionBumper = bumper(myTriport.E);
 bumper autonConfirmationBumper = bumper(myTriport.G);
+bumper goalSensor = bumper(myTriport.C);
+inertial inertialSensor = inertial(PORT11);
 
 // Non-VEX Declarations
 int autonSelector;
@@ -114,9 +173,87 @@ enum MovementDirections
   FORWARD,
   REVERSE
 };
+struct SlewLimits
+{
+  double acceleration;
+  double deceleration;
+};
+struct DriverProfile
+{
+  const char *name;
+  const CurveTable *curve;
+  bool headingHold;
+};
 
 // Non-VEX Intializations
 bool waitingForUserInput = false;
+JamDetector leftIntakeJamDetector = JamDetector(leftIntake, "LI");
+JamDetector rightIntakeJamDetector = JamDetector(rightIntake, "RI");
+// Drive slew limits in percent per 20 msec tick, indexed by DriveConfigurations; fewer drive motors launch gentler
+const SlewLimits driveSlewLimits[] = {{8, 16}, {6, 12}, {6, 12}, {5, 10}, {5, 10}};
+// Arm position in degrees above which the slew limits are scaled down to keep the robot from tipping
+const double ARM_UP_POSITION = 360;
+const double ARM_UP_SLEW_SCALE = 0.5;
+SlewRateLimiter leftDriveSlew;
+SlewRateLimiter rightDriveSlew;
+// Amps the eight motors may draw together before lower priority subsystems are throttled
+const double TOTAL_CURRENT_BUDGET = 16;
+// Order subsystems are served current in, 0 first; change these to reprioritize
+const int DRIVE_CURRENT_PRIORITY = 0;
+const int ARM_CURRENT_PRIORITY = 1;
+const int INTAKE_CURRENT_PRIORITY = 2;
+CurrentBudget currentBudget = CurrentBudget(TOTAL_CURRENT_BUDGET);
+// Seconds ahead motor temperatures are predicted; long enough to save power for the end of a skills run
+const double THERMAL_HORIZON = 45;
+// Whether thermal calibration samples are logged over USB as CSV; only for calibration sessions, never in competition
+const bool THERMAL_LOGGING = false;
+ThermalModel thermalModel = ThermalModel(THERMAL_HORIZON);
+// Loaded battery volts the drive was tuned at; a full battery is trimmed down to it and a tired one boosted up to it
+const double NOMINAL_BATTERY_VOLTAGE = 12.0;
+BatteryCompensation batteryCompensation = BatteryCompensation(Brain.Battery, NOMINAL_BATTERY_VOLTAGE);
+DriveKinematics driveKinematics = DriveKinematics(leftFront, leftBack, rightFront, rightBack, batteryCompensation);
+// Seconds a drive side takes to reach 63% of a step in voltage, and the percent velocity change that marks its response
+const double DRIVE_TIME_CONSTANT = 0.15;
+const double DRIVE_RESPONSE_THRESHOLD = 5;
+SmithPredictor leftDrivePredictor = SmithPredictor(1, DRIVE_TIME_CONSTANT, DRIVE_RESPONSE_THRESHOLD);
+SmithPredictor rightDrivePredictor = SmithPredictor(1, DRIVE_TIME_CONSTANT, DRIVE_RESPONSE_THRESHOLD);
+// Seconds between usercontrol() ticks, the step each MPC plan is made in
+const double DRIVE_TICK_TIME = 0.02;
+// Volts a drive motor is commanded at full stick
+const double MAX_DRIVE_VOLTAGE = 12.0;
+MpcDrive leftDriveMpc = MpcDrive(DRIVE_TIME_CONSTANT, DRIVE_TICK_TIME);
+MpcDrive rightDriveMpc = MpcDrive(DRIVE_TIME_CONSTANT, DRIVE_TICK_TIME);
+TractionControl tractionControl = TractionControl(leftFront, leftBack, rightFront, rightBack, DRIVE_TIME_CONSTANT, DRIVE_TICK_TIME);
+DriveStats driveStats = DriveStats(leftFront, leftBack, rightFront, rightBack, tractionControl);
+// Holds the heading on a straight push for driver profiles that ask for it
+HeadingHold headingHold = HeadingHold(inertialSensor);
+// Whether driver control is recorded to the SD card as a route, and the milliseconds between samples
+const bool ROUTE_RECORDING = true;
+const int ROUTE_SAMPLE_PERIOD = 10;
+// Milliseconds between checks for clamp changes, which are recorded the moment they are seen
+const int ROUTE_EVENT_PERIOD = 1;
+RouteRecorder routeRecorder = RouteRecorder(Brain.SDcard, clamp, ROUTE_SAMPLE_PERIOD);
+// Milliseconds between route playback ticks, and the SD card route that replaces the built-in main auton
+const int ROUTE_PLAYBACK_PERIOD = 10;
+const char *MAIN_AUTON_FILE = "main.bin";
+// Where the main auton recording starts: assumed against the red alliance wall, facing across the field. Not
+// measured yet, so the selector shows it as unknown; set MAIN_AUTON_START_MEASURED once it has been
+constexpr RoutePose MAIN_AUTON_START = {-60, -36, 90};
+const bool MAIN_AUTON_START_MEASURED = false;
+// Autonomous routes the selector cycles through, in autonSelector order; blue plays the red recording mirrored
+const RouteEntry autonRoutes[] = {
+    {"Main Red", RED_ALLIANCE, MAIN_AUTON_START, MAIN_AUTON_START_MEASURED, &MAIN_AUTON_ROUTE, MAIN_AUTON_FILE, false},
+    {"Main Blue", BLUE_ALLIANCE, MirrorAcrossCenterline::pose(MAIN_AUTON_START), MAIN_AUTON_START_MEASURED, &MAIN_AUTON_ROUTE, MAIN_AUTON_FILE, true},
+    {"None", EITHER_ALLIANCE, {0, 0, 0}, false, NULL, NULL, false}};
+RouteLibrary routeLibrary(autonRoutes, sizeof(autonRoutes) / sizeof(autonRoutes[0]));
+// Joystick response curves built at compile time as <deadband %, expo %, rate %>
+constexpr CurveTable LINEAR_CURVE = makeCurveTable<0, 0, 100>();
+constexpr CurveTable EXPO_CURVE = makeCurveTable<5, 50, 100>();
+constexpr CurveTable PRECISION_CURVE = makeCurveTable<5, 70, 70>();
+// Driver profiles cycled with ButtonRight; a new driver only needs a new curve and entry here
+const DriverProfile driverProfiles[] = {{"Linear", &LINEAR_CURVE, false}, {"Expo", &EXPO_CURVE, false}, {"Precision", &PRECISION_CURVE, false}, {"Expo Hold", &EXPO_CURVE, true}};
+const int NUMBER_OF_DRIVER_PROFILES = sizeof(driverProfiles) / sizeof(driverProfiles[0]);
+int driverProfile = 1;
 
 /*------------------------------------------------------------------------------------*/
 /*                                                                                    */
@@ -131,6 +268,7 @@ bool waitingForUserInput = false;
 /*    function                                                                        */
 /*  - PID control - NOT FUNCTIONAL, LEAVE COMMENTED OUT                               */
 /*  - Motor Collection Class - Provides additional functionality for VEX V5 motors    */
+/*  - bool isGoalAtClamp() - checks the goal sensor at the mobile goal clamp           */
 /*  - std::string getCompetitionStatus() - gets the current competition state         */
 /*  - vex::color getColorFromValue(std::string value, std::string keyword) - returns  */
 /*    a color based on the given value and keyword                                    */
@@ -145,6 +283,8 @@ bool waitingForUserInput = false;
 /*  - void drawBatteryInfoFrame() - draws the battery info frame                      */
 /*  - void drawControllerInfoFrame() - draws the control frame                        */
 /*  - void drawGUI() - calls the six draw functions above                             */
+/*  - void printAutonSelection() - prints the selected route's details on the         */
+/*    controller                                                                      */
 /*  - void autonSelection() - Autonomous program selection function                   */
 /*------------------------------------------------------------------------------------*/
 
@@ -192,11 +332,8 @@ void turn(double degrees, MovementDirections direction, int velocity)
     motorDegrees *= -1;
   }
 
-  // Spins the robot's four drive motors based on the given and calculated parameters
-  leftBack.spinFor(vex::directionType::fwd, motorDegrees, vex::rotationUnits::deg, velocity, vex::velocityUnits::pct, false);
-  rightBack.spinFor(vex::directionType::fwd, motorDegrees * -1, vex::rotationUnits::deg, velocity, vex::velocityUnits::pct, false);
-  leftFront.spinFor(vex::directionType::fwd, motorDegrees, vex::rotationUnits::deg, velocity, vex::velocityUnits::pct, false);
-  rightFront.spinFor(vex::directionType::fwd, motorDegrees * -1, vex::rotationUnits::deg, velocity, vex::velocityUnits::pct, true);
+  // Spins the robot's working drive motors based on the given and calculated parameters, slower if any are lost
+  driveKinematics.spinFor(motorDegrees, motorDegrees * -1, velocity);
 }
 
 /**
@@ -227,11 +364,8 @@ void drive(double inches, MovementDirections direction, int velocity)
     motorDegrees *= -1;
   }
 
-  // Spins the robot's four drive motors based on the given and calculated parameters
-  leftBack.spinFor(vex::directionType::fwd, motorDegrees, vex::rotationUnits::deg, velocity, vex::velocityUnits::pct, false);
-  rightBack.spinFor(vex::directionType::fwd, motorDegrees, vex::rotationUnits::deg, velocity, vex::velocityUnits::pct, false);
-  leftFront.spinFor(vex::directionType::fwd, motorDegrees, vex::rotationUnits::deg, velocity, vex::velocityUnits::pct, false);
-  rightFront.spinFor(vex::directionType::fwd, motorDegrees, vex::rotationUnits::deg, velocity, vex::velocityUnits::pct, true);
+  // Spins the robot's working drive motors based on the given and calculated parameters, slower if any are lost
+  driveKinematics.spinFor(motorDegrees, motorDegrees, velocity);
 }
 
 /**
@@ -327,7 +461,7 @@ public:
     {
       driveConfig = RFLB;
     }
-    if (std::find(disconnectedMotorNames.begin(), disconnectedMotorNames.end(), "LB") != disconnectedMotorNames.end() || std::find(disconnectedMotorNames.begin(),
+    if (std::find(disconnectedMotorNames.begin(), disconnectedMotorNames.end(), "LB") != disconnectedMotorNames.end() && std::find(disconnectedMotorNames.begin(),
                                                                                                                                    disconnectedMotorNames.end(), "RF") != disconnectedMotorNames.end())
     {
       driveConfig = LFRB;
@@ -391,6 +525,29 @@ public:
 // Initialization of MotorCollection
 MotorCollection myMotorCollection;
 
+/**
+ * @brief checks whether a mobile goal is pressed against the clamp
+ * @details Swap the body for a limit switch or distance sensor check if the goal sensor changes.
+ * @relates AutoClamp
+ * @returns bool true while a mobile goal is at the clamp
+ * @date 10/18/2026
+ */
+bool isGoalAtClamp()
+{
+  return goalSensor.pressing() == 1;
+}
+
+// Initialization of AutoClamp
+AutoClamp autoClamp = AutoClamp(clamp, isGoalAtClamp);
+
+// Initialization of ScoringMacro
+ScoringMacro scoringMacro = ScoringMacro(intakeMotors, armMotors, autoClamp, isGoalAtClamp);
+
+// Initialization of RoutePlayer - clamp events go through AutoClamp so it tracks what the route does, and
+// the drive through DriveKinematics so a lost motor is skipped and the route slowed to the speed limit, and
+// the schedule slowed to what the battery can still drive
+RoutePlayer routePlayer = RoutePlayer(autoClamp, driveKinematics, batteryCompensation);
+
 /**
  * @brief gets the state of the VEX V5 Competition Control as a String
  * @relates drawModeDisplayFrame()
@@ -660,19 +817,22 @@ void drawControlsFrame()
   // Draws maroon rectangle at above coordinates
   Brain.Screen.drawRectangle(controlsFrame["x-left"], controlsFrame["y-top"], controlsFrame["x-right"] - controlsFrame["x-left"], controlsFrame["y-bottom"] - controlsFrame["y-top"], color(128, 0, 0));
 
-  // Prints Controls in the frame
-  std::vector<std::string> controls = {"Driving - Tank", "Lift Arm - R1", "Lower Arm - R2", "Intake - L1", "Outtake - L2", "Clamp - X", "Toggle - Up"};
+  // Prints Controls in the frame, in a smaller font so every binding fits above the auton selector
+  std::vector<std::string> controls = {"Driving - Tank", "Arm - R1 / R2", "Arm Preset - Up/Dn", "Intake - L1 / L2", "Clamp X, Auto Y", "Score Macro - A",
+                                       "MPC Drive - B", "Slew/Stats - Left", "Profile - Right"};
   Brain.Screen.setFillColor(color(128, 0, 0));
   Brain.Screen.setPenColor(color::white);
   Brain.Screen.setCursor(1, 5);
   Brain.Screen.print("Controls:");
-  int row = 2;
+  Brain.Screen.setFont(vex::fontType::mono15);
+  int row = 3;
   for (int i = 0; i < controls.size(); i++)
   {
     Brain.Screen.setCursor(row, 2);
     Brain.Screen.print(controls[i].c_str());
     row++;
   }
+  Brain.Screen.setFont(vex::fontType::mono20);
 }
 
 /**
@@ -693,11 +853,15 @@ void drawAutonSelectorFrame()
   // Draws maroon rectangle at above coordinates
   Brain.Screen.drawRectangle(autonSelectorFrame["x-left"], autonSelectorFrame["y-top"], autonSelectorFrame["x-right"] - autonSelectorFrame["x-left"], autonSelectorFrame["y-bottom"] - autonSelectorFrame["y-top"], color(128, 0, 0));
 
-  // Gets and prints the color-coordinated current autonomous selection and whether the selection is locked or not in the frame
+  // Prints the selected route's name in its alliance color, its duration and checksum status, and whether the selection is locked or not in the frame
+  const RouteEntry &autonRoute = routeLibrary.getEntry(autonSelector);
   Brain.Screen.setCursor(10, 2);
-  Brain.Screen.print("Auton: ");
-  Brain.Screen.print(autonSelector);
+  Brain.Screen.setPenColor(autonRoute.side == RED_ALLIANCE ? color::red : autonRoute.side == BLUE_ALLIANCE ? color::blue : color::white);
+  Brain.Screen.print("%s", autonRoute.name);
   Brain.Screen.setCursor(11, 2);
+  Brain.Screen.setPenColor(routeLibrary.isVerified() ? color::white : color::red);
+  Brain.Screen.print("%.1fs %s", routeLibrary.getDuration(), !routeLibrary.isVerified() ? "BAD" : routeLibrary.isFromCard() ? "SD" : "OK");
+  Brain.Screen.setCursor(12, 2);
   Brain.Screen.setPenColor(getColorFromValue(waitingForUserInput, USER_INPUT));
   if (waitingForUserInput)
   {
@@ -821,6 +985,10 @@ void drawBatteryInfoFrame()
   Brain.Screen.setPenColor(getColorFromValue((int)Brain.Battery.capacity(), BATTERY));
   Brain.Screen.print("%d%%", Brain.Battery.capacity());
   Brain.Screen.setPenColor(color::white);
+
+  // Prints the filtered voltage and estimated internal resistance behind the drive's sag compensation
+  Brain.Screen.setCursor(12, 20);
+  Brain.Screen.print("%.1fV %.0fmO", batteryCompensation.getFilteredVoltage(), batteryCompensation.getInternalResistance() * 1000);
 }
 
 /**
@@ -878,6 +1046,41 @@ void drawGUI()
   }
 }
 
+/**
+ * @brief prints the selected route's name, alliance, start pose, duration and checksum on the controller
+ * @details The start pose is where to place the robot: inches from the field center and heading clockwise.
+ * A pose that has not been measured yet is shown as unknown rather than as a placement to trust, and a route
+ * that does nothing can start anywhere.
+ * The checksum is marked SD for a route from the SD card, OK for a built-in route that matches the one
+ * compiled, and BAD for one that does not and will not play.
+ * @relates autonSelection()
+ * @date 10/18/2026
+ */
+void printAutonSelection()
+{
+  const RouteEntry &autonRoute = routeLibrary.getEntry(autonSelector);
+  const char *allianceNames[] = {"Red", "Blue", "Any"};
+  Controller1.Screen.clearScreen();
+  Controller1.Screen.setCursor(1, 1);
+  Controller1.Screen.print("%s (%s)", autonRoute.name, allianceNames[autonRoute.side]);
+  Controller1.Screen.setCursor(2, 1);
+  if (autonRoute.table == NULL && autonRoute.fileName == NULL)
+  {
+    Controller1.Screen.print("Start anywhere");
+  }
+  else if (autonRoute.startMeasured)
+  {
+    Controller1.Screen.print("Start %.0f,%.0f %.0fdeg", autonRoute.startPose.x, autonRoute.startPose.y, autonRoute.startPose.heading);
+  }
+  else
+  {
+    Controller1.Screen.print("Start unknown");
+  }
+  Controller1.Screen.setCursor(3, 1);
+  Controller1.Screen.print("%.1fs %08lX %s", routeLibrary.getDuration(), (unsigned long)routeLibrary.getChecksum(),
+                           !routeLibrary.isVerified() ? "BAD" : routeLibrary.isFromCard() ? "SD" : "OK");
+}
+
 /**
  * @brief manages user input for the auton selector
  * @relates pre_auton()
@@ -908,7 +1111,7 @@ void autonSelection()
       // Checks if the user touches the on-screen auton selection button
       if (localLastTouchX >= autonSelectorFrame["x-left"] && localLastTouchX <= autonSelectorFrame["x-right"] && localLastTouchY >= autonSelectorFrame["y-top"] && localLastTouchY <= autonSelectorFrame["y-bottom"])
       {
-        if (autonSelector < 2)
+        if (autonSelector < routeLibrary.getCount() - 1)
         {
           autonSelector++;
         }
@@ -916,6 +1119,8 @@ void autonSelection()
         {
           autonSelector = 0;
         }
+        routeLibrary.select(autonSelector);
+        printAutonSelection();
 
         wait(200, msec);
         drawGUI();
@@ -925,7 +1130,7 @@ void autonSelection()
     // Checks if the user presses the physical auton selection bumper
     if (autonSelectionBumper.pressing() == 1)
     {
-      if (autonSelector < 2)
+      if (autonSelector < routeLibrary.getCount() - 1)
       {
         autonSelector++;
       }
@@ -933,6 +1138,8 @@ void autonSelection()
       {
         autonSelector = 0;
       }
+      routeLibrary.select(autonSelector);
+      printAutonSelection();
       drawGUI();
     }
 
@@ -963,6 +1170,36 @@ void motorTracking()
   }
 }
 
+/**
+ * @brief samples the goal sensor every 5 msec so the clamp fires the instant a goal is confirmed
+ * @relates pre_auton()
+ * @date 10/18/2026
+ */
+void clampTracking()
+{
+  while (true)
+  {
+    autoClamp.update();
+    wait(5, msec);
+  }
+}
+
+/**
+ * @brief samples the battery, advances the thermal model and redistributes the robot-wide current budget every 20 msec in every game state
+ * @relates pre_auton()
+ * @date 10/18/2026
+ */
+void currentBudgetTracking()
+{
+  while (true)
+  {
+    batteryCompensation.update();
+    thermalModel.update();
+    currentBudget.update();
+    wait(20, msec);
+  }
+}
+
 /**
  * @brief
  * @relates
@@ -1001,139 +1238,55 @@ void timeTracking()
 }
 
 /**
- * @brief
- * @relates
- * @author Leo Abubucker
- * @date
+ * @brief records driver control to the SD card as a binary route, one record every ROUTE_SAMPLE_PERIOD msec
+ * @details Recording starts when driver control is enabled and stops when it is disabled. Samples are
+ * timed against the Brain timer rather than a fixed wait so they stay on the 10 msec grid; between them
+ * the clamp is checked every ROUTE_EVENT_PERIOD msec so its changes land on the same timeline within a
+ * millisecond. The card writes happen on the recorder's own task (see route-recorder.cpp).
+ * @relates pre_auton()
+ * @date 10/18/2026
  */
 void autonomousTracking()
 {
-  // (abs(Controller1.Axis3.value()) < AXIS_DEVIATION) && (abs(Controller1.Axis2.value()) < AXIS_DEVIATION) &&
-  // const int AXIS_DEVIATION = 5;
-  // // Drivetrain Tracking
-  // double currentLeftDrivePosition = (leftFront.position(vex::rotationUnits::deg) + leftBack.position(vex::rotationUnits::deg)) / 2.0;
-  // double currentRightDrivePosition = (rightFront.position(vex::rotationUnits::deg) + rightBack.position(vex::rotationUnits::deg)) / 2.0;
-  // double currentArmPosition = (leftArm.position(vex::rotationUnits::deg) + rightArm.position(vex::rotationUnits::deg)) / 2.0;
-  // double currentIntakePosition = (leftIntake.position(vex::rotationUnits::deg) + rightIntake.position(vex::rotationUnits::deg)) / 2.0;
-  // bool currentClampPosition = clamp.value(); // True (1) is extended, False (0) is retracted
-  float lfPos;
-  float lbPos;
-  float rfPos;
-  float rbPos;
+  bool recordingStarted = false;
+  bool startFailureLogged = false;
+  double nextSampleTime = Brain.timer(vex::timeUnits::msec);
   while (true)
   {
+    bool driverControl = ROUTE_RECORDING && Competition.isDriverControl() && Competition.isEnabled();
+    if (driverControl && !recordingStarted)
+    {
+      // Retried every sample until it works, so a card inserted late or a last route still flushing only costs the start
+      recordingStarted = routeRecorder.start();
+      if (!recordingStarted && !startFailureLogged)
+      {
+        printf("Route recorder: cannot start yet (no SD card, no free file or last route still writing), retrying\n");
+      }
+      startFailureLogged = !recordingStarted;
+    }
+    else if (!driverControl && recordingStarted)
+    {
+      routeRecorder.stop();
+      recordingStarted = false;
+    }
+    else if (!driverControl)
+    {
+      startFailureLogged = false;
+    }
+    routeRecorder.sample();
 
-    // If drive motors aren't spinning and there is a difference in either position
-    // if (((currentLeftDrivePosition != (leftFront.position(vex::rotationUnits::deg) + leftBack.position(vex::rotationUnits::deg)) / 2.0) || (currentRightDrivePosition != (rightFront.position(vex::rotationUnits::deg) + rightBack.position(vex::rotationUnits::deg)) / 2.0)))
-    // {
-    // currentLeftDrivePosition = (leftFront.position(vex::rotationUnits::deg) + leftBack.position(vex::rotationUnits::deg)) / 2.0;
-    // currentRightDrivePosition = (rightFront.position(vex::rotationUnits::deg) + rightBack.position(vex::rotationUnits::deg)) / 2.0;
-    // float lfPosition = leftFront.position(vex::rotationUnits::deg);
-    // float lbPosition = leftBack.position(vex::rotationUnits::deg);
-    // float rfPosition = rightFront.position(vex::rotationUnits::deg);
-    // float rbPosition = rightBack.position(vex::rotationUnits::deg);
-
-    // std::string lFPrint = "leftFront.spinToPosition(" + to_string(lfPosition) + ", vex::rotationUnits::deg, false);";
-    // std::string lBPrint = "leftBack.spinToPosition(" + to_string(lbPosition) + ", vex::rotationUnits::deg, false);";
-    // std::string rFPrint = "rightFront.spinToPosition(" + to_string(rfPosition) + ", vex::rotationUnits::deg, false);";
-    // std::string rBPrint = "rightBack.spinToPosition(" + to_string(rbPosition) + ", vex::rotationUnits::deg, true);";
-    // std::string waitStatement = "wait(25, msec);";
-    // std::cout << lFPrint;
-    // std::cout << lBPrint;
-    // std::cout << rFPrint;
-    // std::cout << rBPrint;
-    // std::cout << waitStatement;
-    lfPos = leftFront.position(degrees);
-    lbPos = leftBack.position(degrees);
-    rfPos = rightFront.position(degrees);
-    rbPos = rightBack.position(degrees);
-
-    // if ((leftFront.position(degrees) != lfPos))
-    // {
-      lfPos = leftFront.position(degrees);
-      lbPos = leftBack.position(degrees);
-      rfPos = rightFront.position(degrees);
-      rbPos = rightBack.position(degrees);
-      printf("leftFront.spinToPosition(%f, degrees, false);\n", lfPos);
-      printf("leftBack.spinToPosition(%f, degrees, false);\n", lbPos);
-      printf("rightFront.spinToPosition(%f, degrees, false);\n", rfPos);
-      printf("rightBack.spinToPosition(%f, degrees, false);\n", rbPos);
-      printf("wait(250, msec);\n");
-      wait(250, msec);
-    // }
-
-    // }
-
-    // Printing to SD Card if Attached
-    // if (Brain.SDcard.isInserted())
-    // {
-    //   FILE *autonProg = fopen("autonProg.txt", "a");
-    //   std::string leftDriveStr = "LD" + to_string(currentLeftDrivePosition) + "\n";
-    //   std::string rightDriveStr = "RD" + to_string(currentRightDrivePosition) + "\n";
-    //   fprintf(autonProg, leftDriveStr.c_str());
-    //   fprintf(autonProg, rightDriveStr.c_str());
-    //   fclose(autonProg);
-    // }
-
-    // Arm Tracking
-
-    // // If arm motors aren't spinning and there is a difference in position
-    // if ((!armMotors.isSpinning()) && (currentArmPosition != (leftArm.position(vex::rotationUnits::deg) + rightArm.position(vex::rotationUnits::deg)) / 2.0))
-    // {
-    //   currentArmPosition = (leftArm.position(vex::rotationUnits::deg) + rightArm.position(vex::rotationUnits::deg)) / 2.0;
-    //   std::string armPrint = "armMotors.spinTo(" + to_string(currentArmPosition) + ", vex::rotationUnits::deg, false);";
-    //   std::cout << armPrint << std::endl;
-
-    //   // Printing to SD Card if Attached
-    //   // if (Brain.SDcard.isInserted())
-    //   // {
-    //   //   FILE *autonProg = fopen("autonProg.txt", "a");
-    //   //   std::string armStr = "A" + to_string(currentArmPosition) + "\n";
-    //   //   fprintf(autonProg, armStr.c_str());
-    //   //   fclose(autonProg);
-    //   // }
-    // }
-
-    // // Intake Tracking
-
-    // // If intake motors aren't spinning and there is a difference in position
-    // if ((!intakeMotors.isSpinning()) && (currentIntakePosition != (leftIntake.position(vex::rotationUnits::deg) + rightIntake.position(vex::rotationUnits::deg)) / 2.0))
-    // {
-    //   currentIntakePosition = (leftIntake.position(vex::rotationUnits::deg) + rightIntake.position(vex::rotationUnits::deg)) / 2.0;
-    //   std::string intakePrint = "intakeMotors.spinTo(" + to_string(currentIntakePosition) + ", vex::rotationUnits::deg, false);";
-    //   std::cout << intakePrint << std::endl;
-
-    //   // Printing to SD Card if Attached
-    //   // if (Brain.SDcard.isInserted())
-    //   // {
-    //   //   FILE *autonProg = fopen("autonProg.txt", "a");
-    //   //   std::string intakeStr = "I" + to_string(currentIntakePosition) + "\n";
-    //   //   fprintf(autonProg, intakeStr.c_str());
-    //   //   fclose(autonProg);
-    //   // }
-    // }
-
-    // // Clamp Tracking
-
-    // // If there is a difference in position
-    // if (currentClampPosition != clamp.value())
-    // {
-    //   currentClampPosition = clamp.value();
-
-    //   std::string clampPositionStr = currentClampPosition ? "true" : "false";
-    //   std::string clampPrint = "clamp.set(" + clampPositionStr + ");";
-    //   std::cout << clampPrint << std::endl;
-
-    //   // Printing to SD Card if Attached
-    //   // if (Brain.SDcard.isInserted())
-    //   // {
-    //   //   FILE *autonProg = fopen("autonProg.txt", "a");
-    //   //   std::string clampStr = "C" + to_string(currentClampPosition) + "\n";
-    //   //   fprintf(autonProg, clampStr.c_str());
-    //   //   fclose(autonProg);
-    //   // }
-    // }
-    // wait(100, msec);
+    nextSampleTime += ROUTE_SAMPLE_PERIOD;
+    double now = Brain.timer(vex::timeUnits::msec);
+    if (nextSampleTime < now)
+    {
+      nextSampleTime = now;
+    }
+    while (now < nextSampleTime)
+    {
+      wait(fmin(ROUTE_EVENT_PERIOD, nextSampleTime - now), msec);
+      routeRecorder.poll();
+      now = Brain.timer(vex::timeUnits::msec);
+    }
   }
 }
 /*------------------------------------------------------------------------------------*/
@@ -1169,17 +1322,54 @@ void pre_auton()
   myMotorCollection.addMotor(rightIntake, "RI");
   myMotorCollection.addMotor(leftIntake, "LI");
 
+  // RouteRecorder and RoutePlayer Initialization - channels in RouteChannels order
+  routeRecorder.addMotor(leftFront);
+  routeRecorder.addMotor(leftBack);
+  routeRecorder.addMotor(rightFront);
+  routeRecorder.addMotor(rightBack);
+  routeRecorder.addMotor(leftArm);
+  routeRecorder.addMotor(rightArm);
+  routeRecorder.addMotor(leftIntake);
+  routeRecorder.addMotor(rightIntake);
+  routePlayer.addMotor(leftFront);
+  routePlayer.addMotor(leftBack);
+  routePlayer.addMotor(rightFront);
+  routePlayer.addMotor(rightBack);
+  routePlayer.addMotor(leftArm);
+  routePlayer.addMotor(rightArm);
+  routePlayer.addMotor(leftIntake);
+  routePlayer.addMotor(rightIntake);
+
+  // Inertial Sensor Calibration - runs in the background during auton selection; the robot must stay still
+  inertialSensor.calibrate();
+
   // Thread Initialization
   thread autonTrackingThread = thread(autonomousTracking);
   thread guiUpdatingThread = thread(drawGUI);
   thread motorTrackingThread = thread(motorTracking);
+  thread clampTrackingThread = thread(clampTracking);
+  currentBudget.addSubsystem("drive", DRIVE_CURRENT_PRIORITY, {leftFront, leftBack, rightFront, rightBack});
+  currentBudget.addSubsystem("arm", ARM_CURRENT_PRIORITY, {leftArm, rightArm});
+  currentBudget.addSubsystem("intake", INTAKE_CURRENT_PRIORITY, {leftIntake, rightIntake});
+  thermalModel.addMotor(leftFront, "LF");
+  thermalModel.addMotor(leftBack, "LB");
+  thermalModel.addMotor(rightFront, "RF");
+  thermalModel.addMotor(rightBack, "RB");
+  thermalModel.addMotor(leftArm, "LA");
+  thermalModel.addMotor(rightArm, "RA");
+  thermalModel.addMotor(leftIntake, "LI");
+  thermalModel.addMotor(rightIntake, "RI");
+  thermalModel.setLogging(THERMAL_LOGGING);
+  currentBudget.setThermalModel(&thermalModel);
+  thread currentBudgetTrackingThread = thread(currentBudgetTracking);
 
   // Auton Selection
   autonSelector = 0;
+  routeLibrary.select(autonSelector);
+  printAutonSelection();
   autonSelection();
 
   // Motor Initialization
-  allMotors.setMaxTorque(100, vex::percentUnits::pct);
   allMotors.setVelocity(100, vex::percentUnits::pct);
   armMotors.setVelocity(100, vex::velocityUnits::pct);
   allMotors.setTimeout(5, vex::timeUnits::sec);
@@ -1195,343 +1385,15 @@ void pre_auton()
  */
 void autonomous()
 {
-  if (autonSelector == 0)
-  {
-leftFront.spinToPosition(0.000000, degrees, false);
-leftBack.spinToPosition(0.000000, degrees, false);
-rightFront.spinToPosition(0.000000, degrees, false);
-rightBack.spinToPosition(0.000000, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(16.000000, degrees, false);
-leftBack.spinToPosition(12.800000, degrees, false);
-rightFront.spinToPosition(10.800000, degrees, false);
-rightBack.spinToPosition(9.600000, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(184.399994, degrees, false);
-leftBack.spinToPosition(181.600006, degrees, false);
-rightFront.spinToPosition(182.399994, degrees, false);
-rightBack.spinToPosition(182.399994, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(448.399994, degrees, false);
-leftBack.spinToPosition(442.399994, degrees, false);
-rightFront.spinToPosition(438.399994, degrees, false);
-rightBack.spinToPosition(436.799988, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(722.799988, degrees, false);
-leftBack.spinToPosition(719.200012, degrees, false);
-rightFront.spinToPosition(710.400024, degrees, false);
-rightBack.spinToPosition(713.599976, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(1003.200012, degrees, false);
-leftBack.spinToPosition(997.200012, degrees, false);
-rightFront.spinToPosition(994.400024, degrees, false);
-rightBack.spinToPosition(996.799988, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(1278.000000, degrees, false);
-leftBack.spinToPosition(1280.000000, degrees, false);
-rightFront.spinToPosition(1280.000000, degrees, false);
-rightBack.spinToPosition(1276.000000, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(1485.599976, degrees, false);
-leftBack.spinToPosition(1492.400024, degrees, false);
-rightFront.spinToPosition(1563.199951, degrees, false);
-rightBack.spinToPosition(1556.400024, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(1382.800049, degrees, false);
-leftBack.spinToPosition(1388.800049, degrees, false);
-rightFront.spinToPosition(1792.800049, degrees, false);
-rightBack.spinToPosition(1791.199951, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(1251.199951, degrees, false);
-leftBack.spinToPosition(1262.000000, degrees, false);
-rightFront.spinToPosition(1942.800049, degrees, false);
-rightBack.spinToPosition(1938.000000, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(1085.599976, degrees, false);
-leftBack.spinToPosition(1097.599976, degrees, false);
-rightFront.spinToPosition(2093.600098, degrees, false);
-rightBack.spinToPosition(2089.600098, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(928.000000, degrees, false);
-leftBack.spinToPosition(938.400024, degrees, false);
-rightFront.spinToPosition(2342.399902, degrees, false);
-rightBack.spinToPosition(2342.399902, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(900.400024, degrees, false);
-leftBack.spinToPosition(900.000000, degrees, false);
-rightFront.spinToPosition(2455.199951, degrees, false);
-rightBack.spinToPosition(2456.399902, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(1098.800049, degrees, false);
-leftBack.spinToPosition(1097.599976, degrees, false);
-rightFront.spinToPosition(2628.000000, degrees, false);
-rightBack.spinToPosition(2626.399902, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(1360.800049, degrees, false);
-leftBack.spinToPosition(1356.000000, degrees, false);
-rightFront.spinToPosition(2854.000000, degrees, false);
-rightBack.spinToPosition(2852.000000, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(1616.400024, degrees, false);
-leftBack.spinToPosition(1614.400024, degrees, false);
-rightFront.spinToPosition(2770.800049, degrees, false);
-rightBack.spinToPosition(2771.600098, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(1852.400024, degrees, false);
-leftBack.spinToPosition(1853.599976, degrees, false);
-rightFront.spinToPosition(2544.399902, degrees, false);
-rightBack.spinToPosition(2542.399902, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(1973.199951, degrees, false);
-leftBack.spinToPosition(1976.400024, degrees, false);
-rightFront.spinToPosition(2486.399902, degrees, false);
-rightBack.spinToPosition(2482.000000, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(2169.199951, degrees, false);
-leftBack.spinToPosition(2169.600098, degrees, false);
-rightFront.spinToPosition(2667.600098, degrees, false);
-rightBack.spinToPosition(2660.800049, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(2433.600098, degrees, false);
-leftBack.spinToPosition(2431.199951, degrees, false);
-rightFront.spinToPosition(2917.600098, degrees, false);
-rightBack.spinToPosition(2915.199951, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(2710.800049, degrees, false);
-leftBack.spinToPosition(2705.600098, degrees, false);
-rightFront.spinToPosition(3186.800049, degrees, false);
-rightBack.spinToPosition(3184.000000, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(2978.399902, degrees, false);
-leftBack.spinToPosition(2978.399902, degrees, false);
-rightFront.spinToPosition(3278.399902, degrees, false);
-rightBack.spinToPosition(3278.399902, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(3077.199951, degrees, false);
-leftBack.spinToPosition(3078.399902, degrees, false);
-rightFront.spinToPosition(3237.600098, degrees, false);
-rightBack.spinToPosition(3238.399902, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(3190.800049, degrees, false);
-leftBack.spinToPosition(3189.600098, degrees, false);
-rightFront.spinToPosition(3346.399902, degrees, false);
-rightBack.spinToPosition(3343.199951, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(3415.199951, degrees, false);
-leftBack.spinToPosition(3415.600098, degrees, false);
-rightFront.spinToPosition(3572.800049, degrees, false);
-rightBack.spinToPosition(3569.199951, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(3667.600098, degrees, false);
-leftBack.spinToPosition(3667.199951, degrees, false);
-rightFront.spinToPosition(3648.000000, degrees, false);
-rightBack.spinToPosition(3649.199951, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(3905.600098, degrees, false);
-leftBack.spinToPosition(3905.600098, degrees, false);
-rightFront.spinToPosition(3651.199951, degrees, false);
-rightBack.spinToPosition(3648.800049, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(4150.399902, degrees, false);
-leftBack.spinToPosition(4148.399902, degrees, false);
-rightFront.spinToPosition(3841.600098, degrees, false);
-rightBack.spinToPosition(3839.600098, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(4224.000000, degrees, false);
-leftBack.spinToPosition(4250.799805, degrees, false);
-rightFront.spinToPosition(4100.399902, degrees, false);
-rightBack.spinToPosition(4097.600098, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(4231.600098, degrees, false);
-leftBack.spinToPosition(4249.600098, degrees, false);
-rightFront.spinToPosition(4361.600098, degrees, false);
-rightBack.spinToPosition(4363.200195, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(4256.399902, degrees, false);
-leftBack.spinToPosition(4263.600098, degrees, false);
-rightFront.spinToPosition(4496.399902, degrees, false);
-rightBack.spinToPosition(4496.399902, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(4436.000000, degrees, false);
-leftBack.spinToPosition(4432.799805, degrees, false);
-rightFront.spinToPosition(4643.600098, degrees, false);
-rightBack.spinToPosition(4642.799805, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(4690.000000, degrees, false);
-leftBack.spinToPosition(4684.799805, degrees, false);
-rightFront.spinToPosition(4791.600098, degrees, false);
-rightBack.spinToPosition(4788.799805, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(4933.600098, degrees, false);
-leftBack.spinToPosition(4936.799805, degrees, false);
-rightFront.spinToPosition(4773.600098, degrees, false);
-rightBack.spinToPosition(4774.399902, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(5022.799805, degrees, false);
-leftBack.spinToPosition(5033.600098, degrees, false);
-rightFront.spinToPosition(4760.799805, degrees, false);
-rightBack.spinToPosition(4761.600098, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(5134.799805, degrees, false);
-leftBack.spinToPosition(5138.399902, degrees, false);
-rightFront.spinToPosition(4724.399902, degrees, false);
-rightBack.spinToPosition(4724.000000, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(5257.200195, degrees, false);
-leftBack.spinToPosition(5255.600098, degrees, false);
-rightFront.spinToPosition(4858.000000, degrees, false);
-rightBack.spinToPosition(4852.799805, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(5509.200195, degrees, false);
-leftBack.spinToPosition(5505.600098, degrees, false);
-rightFront.spinToPosition(5110.000000, degrees, false);
-rightBack.spinToPosition(5108.799805, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(5788.000000, degrees, false);
-leftBack.spinToPosition(5788.399902, degrees, false);
-rightFront.spinToPosition(5392.799805, degrees, false);
-rightBack.spinToPosition(5391.200195, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(6074.000000, degrees, false);
-leftBack.spinToPosition(6070.799805, degrees, false);
-rightFront.spinToPosition(5678.399902, degrees, false);
-rightBack.spinToPosition(5675.200195, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(6359.600098, degrees, false);
-leftBack.spinToPosition(6353.600098, degrees, false);
-rightFront.spinToPosition(5805.600098, degrees, false);
-rightBack.spinToPosition(5804.000000, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(6523.200195, degrees, false);
-leftBack.spinToPosition(6533.600098, degrees, false);
-rightFront.spinToPosition(5810.799805, degrees, false);
-rightBack.spinToPosition(5809.600098, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(6668.799805, degrees, false);
-leftBack.spinToPosition(6663.200195, degrees, false);
-rightFront.spinToPosition(5904.000000, degrees, false);
-rightBack.spinToPosition(5900.799805, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(6919.200195, degrees, false);
-leftBack.spinToPosition(6916.399902, degrees, false);
-rightFront.spinToPosition(6148.000000, degrees, false);
-rightBack.spinToPosition(6149.600098, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(7199.200195, degrees, false);
-leftBack.spinToPosition(7192.799805, degrees, false);
-rightFront.spinToPosition(6354.000000, degrees, false);
-rightBack.spinToPosition(6352.000000, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(7445.600098, degrees, false);
-leftBack.spinToPosition(7447.200195, degrees, false);
-rightFront.spinToPosition(6316.000000, degrees, false);
-rightBack.spinToPosition(6315.200195, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(7567.200195, degrees, false);
-leftBack.spinToPosition(7563.200195, degrees, false);
-rightFront.spinToPosition(6352.000000, degrees, false);
-rightBack.spinToPosition(6347.200195, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(7762.799805, degrees, false);
-leftBack.spinToPosition(7760.799805, degrees, false);
-rightFront.spinToPosition(6497.600098, degrees, false);
-rightBack.spinToPosition(6495.600098, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(8018.000000, degrees, false);
-leftBack.spinToPosition(8019.200195, degrees, false);
-rightFront.spinToPosition(6373.600098, degrees, false);
-rightBack.spinToPosition(6372.399902, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(8245.200195, degrees, false);
-leftBack.spinToPosition(8244.799805, degrees, false);
-rightFront.spinToPosition(6167.600098, degrees, false);
-rightBack.spinToPosition(6167.200195, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(8353.599609, degrees, false);
-leftBack.spinToPosition(8348.000000, degrees, false);
-rightFront.spinToPosition(6173.200195, degrees, false);
-rightBack.spinToPosition(6168.000000, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(8551.200195, degrees, false);
-leftBack.spinToPosition(8548.400391, degrees, false);
-rightFront.spinToPosition(6385.200195, degrees, false);
-rightBack.spinToPosition(6384.000000, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(8751.599609, degrees, false);
-leftBack.spinToPosition(8758.400391, degrees, false);
-rightFront.spinToPosition(6658.000000, degrees, false);
-rightBack.spinToPosition(6655.200195, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(8794.000000, degrees, false);
-leftBack.spinToPosition(8792.799805, degrees, false);
-rightFront.spinToPosition(6933.200195, degrees, false);
-rightBack.spinToPosition(6929.600098, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(8911.599609, degrees, false);
-leftBack.spinToPosition(8911.200195, degrees, false);
-rightFront.spinToPosition(7184.799805, degrees, false);
-rightBack.spinToPosition(7184.799805, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(9160.400391, degrees, false);
-leftBack.spinToPosition(9162.400391, degrees, false);
-rightFront.spinToPosition(7435.600098, degrees, false);
-rightBack.spinToPosition(7434.399902, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(9347.599609, degrees, false);
-leftBack.spinToPosition(9362.400391, degrees, false);
-rightFront.spinToPosition(7622.799805, degrees, false);
-rightBack.spinToPosition(7623.200195, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(9472.799805, degrees, false);
-leftBack.spinToPosition(9466.400391, degrees, false);
-rightFront.spinToPosition(7737.600098, degrees, false);
-rightBack.spinToPosition(7740.799805, degrees, false);
-wait(250, msec);
-leftFront.spinToPosition(9491.200195, degrees, false);
-leftBack.spinToPosition(9483.200195, degrees, false);
-rightFront.spinToPosition(7754.799805, degrees, false);
-rightBack.spinToPosition(7753.600098, degrees, false);
-wait(250, msec);
-
-    // leftFront.spinToPosition(0, vex::rotationUnits::deg, false);leftBack.spinToPosition(0, vex::rotationUnits::deg, false);rightFront.spinToPosition(0, vex::rotationUnits::deg, false);rightBack.spinToPosition(0, vex::rotationUnits::deg, false);leftFront.spinToPosition(3.6, vex::rotationUnits::deg, false);leftBack.spinToPosition(3.6, vex::rotationUnits::deg, false);rightFront.spinToPosition(0.6, vex::rotationUnits::deg, false);rightBack.spinToPosition(0.6, vex::rotationUnits::deg,false);leftBack.spinToPosition(360.8, vex::rotationUnits::deg, false);rightFront.spinToPosition(341.4, vex::rotationUnits::deg, false);rightBack.spinToPosition(341.4, vex::rotationUnits::deg, true);wait(25, msec);leftBack.spinToPosition(888.2, vex::rotationUnits::deg, false);rightFront.spinToPosition(866, vex::rotationUnits::deg, false);rightBack.spinToPosition(866, vex::rotationUnits::deg, true);wait(25, msec);leftFront.spinToPosition(910.6, vex::rotationUnits::deg, true);wait(25, msec);leftFront.spinToPosition(1223, vex::rotationUnits::deg, false);leftBack.spinToPosition(1223, vex::rotationUnits::deg, false);rightFront.spinToPosition(1478.2, vex::rotationUnits::deg, false);rightBack.spinToPosition(1924.8, vex::rotationUnits::deg, true);wait(25, msec);leftFront.spinToPosition(1681.8, vex::rotationUnits::deg, false);leftBack.spinToPosition(1681.8, vex::rotationUnits::deg, false);rightFront.spinToPosition(2282.4, vex::rotationUnits::deg, false);rightBack.spinToPosition(2282.4, vex::rotationUnits::deg, true);wait(25, msec);
-    //  if (Brain.SDcard.isInserted())
-    //  {
-    //    FILE *autonProg = fopen("autonProg.txt", "r");
-    //    if (autonProg != NULL)
-    //    {
-    //      const int LENGTH_OF_VALUE = 10;
-    //      const int NUMBER_OF_VALUES = 100;
-    //      char autonValues[NUMBER_OF_VALUES][LENGTH_OF_VALUE];
-    //      for (int i = 0; i < NUMBER_OF_VALUES; i++)
-    //      {
-    //        if (fgets(autonValues[i], LENGTH_OF_VALUE, autonProg))
-    //        {
-    //          puts(autonValues[i]);
-    //        }
-    //      }
-    //      fclose(autonProg);
-    //    }
-    //  }
-    //  Main Auton
-    //  armMotors.spinToPosition(505, vex::rotationUnits::deg, true);
-    //  drive(22.5, "fwd", 75);
-    //  rightIntake.spinToPosition(-225, vex::rotationUnits::deg, true);
-    //  armMotors.spinToPosition(350, vex::rotationUnits::deg, true);
-    //  rightIntake.spinToPosition(-725, vex::rotationUnits::deg, true);
-    //  drive(1, "rev", 75);
-    //  drive(1, "fwd", 75);
-    //  drive(22.5, "rev", 75);
-    //  turn(90, "left", 50);
-    //  armMotors.spinToPosition(0, vex::rotationUnits::deg, true);
-    //  armMotors.spinToPosition(130, vex::rotationUnits::deg, true);
-  }
-  else if (autonSelector == 1)
+  // Selected Route - checked when it was selected; "None" or a route that failed its checksum plays nothing
+  RouteSource *autonRoute = routeLibrary.open();
+  if (autonRoute != NULL)
   {
-    // Alternative Auton
-  }
-  else if (autonSelector == 2)
-  {
-    // NO AUTON - LEAVE BLANK
+    routePlayer.start(*autonRoute);
+    while (routePlayer.update())
+    {
+      wait(ROUTE_PLAYBACK_PERIOD, msec);
+    }
   }
 }
 
@@ -1543,78 +1405,199 @@ wait(250, msec);
  */
 void usercontrol()
 {
-  bool clampState = false;
   bool clampLastState = false;
+  bool autoClampLastState = false;
+  bool scoringMacroLastState = false;
+  bool slewEnabled = true;
+  bool slewLastState = false;
+  bool driverProfileLastState = false;
+  bool mpcEnabled = false;
+  bool mpcLastState = false;
+  double mpcMaxSolveTime = 0;
+  leftDriveSlew.reset(0);
+  rightDriveSlew.reset(0);
+  driveStats.reset();
 
   // thread timeTrackingThread = thread(timeTracking);
 
   // User control code here, inside the loop
   while (1)
   {
-    // Drive Controls
-    if (driveConfig == REAR_WHEEL)
+    // Drive Slew Toggle - Left turns slew limiting off/on and prints the drive stats for the mode just used, plus the thermal fit so far
+    if (Controller1.ButtonLeft.pressing() && !slewLastState)
+    {
+      driveStats.print(slewEnabled ? "Slew ON" : "Slew OFF");
+      thermalModel.printCalibration();
+      printf("Drive dead time: left %.0f msec, right %.0f msec\n", leftDrivePredictor.getDelay(), rightDrivePredictor.getDelay());
+      printf("Drive MPC: longest solve %.0f usec\n", mpcMaxSolveTime);
+      mpcMaxSolveTime = 0;
+      driveStats.reset();
+      slewEnabled = !slewEnabled;
+      slewLastState = true;
+    }
+    else if (!Controller1.ButtonLeft.pressing())
+    {
+      slewLastState = false;
+    }
+
+    // Driver Profile - Right cycles the joystick response curve and heading hold
+    if (Controller1.ButtonRight.pressing() && !driverProfileLastState)
+    {
+      driverProfile = (driverProfile + 1) % NUMBER_OF_DRIVER_PROFILES;
+      Controller1.Screen.clearLine(3);
+      Controller1.Screen.setCursor(3, 1);
+      Controller1.Screen.print(driverProfiles[driverProfile].name);
+      driverProfileLastState = true;
+    }
+    else if (!Controller1.ButtonRight.pressing())
+    {
+      driverProfileLastState = false;
+    }
+
+    // Drive MPC Toggle - B switches the drive between slew limiting and model-predictive control
+    if (Controller1.ButtonB.pressing() && !mpcLastState)
+    {
+      mpcEnabled = !mpcEnabled;
+      Controller1.Screen.clearLine(3);
+      Controller1.Screen.setCursor(3, 1);
+      Controller1.Screen.print(mpcEnabled ? "MPC ON" : "MPC OFF");
+      mpcLastState = true;
+    }
+    else if (!Controller1.ButtonB.pressing())
+    {
+      mpcLastState = false;
+    }
+
+    // Joystick Curves - one table lookup per stick
+    const CurveTable &driveCurve = *driverProfiles[driverProfile].curve;
+    double leftCommand = driveCurve(Controller1.Axis3.value());
+    double rightCommand = driveCurve(Controller1.Axis2.value());
+
+    // Heading Hold - a straight push holds the heading it started on, and any turn releases it at once
+    if (driverProfiles[driverProfile].headingHold)
     {
-      leftBack.spin(vex::directionType::fwd, Controller1.Axis3.position(), vex::velocityUnits::pct);
-      rightBack.spin(vex::directionType::fwd, Controller1.Axis2.position(), vex::velocityUnits::pct);
+      headingHold.apply(leftCommand, rightCommand);
     }
-    else if (driveConfig == FRONT_WHEEL)
+    else
     {
-      leftFront.spin(vex::directionType::fwd, Controller1.Axis3.position(), vex::velocityUnits::pct);
-      rightFront.spin(vex::directionType::fwd, Controller1.Axis2.position(), vex::velocityUnits::pct);
+      headingHold.release();
     }
-    else if (driveConfig == RFLB)
+
+    // Latency Estimation - each side's velocity now, ahead of its delayed sensor reading
+    leftDrivePredictor.predict(leftDriveMotors.velocity(vex::velocityUnits::pct));
+    rightDrivePredictor.predict(rightDriveMotors.velocity(vex::velocityUnits::pct));
+
+    // Drive Acceleration Limiting - with MPC on, each side's voltage is planned toward its curved stick within the slew table's
+    // acceleration and the drive's current share; otherwise each side ramps toward it, more gently with fewer drive motors or the arm up
+    SlewLimits slewLimits = driveSlewLimits[driveConfig];
+    double slewScale = armMotors.position(vex::rotationUnits::deg) > ARM_UP_POSITION ? ARM_UP_SLEW_SCALE : 1;
+    if (mpcEnabled)
     {
-      rightFront.spin(vex::directionType::fwd, Controller1.Axis3.position(), vex::velocityUnits::pct);
-      leftBack.spin(vex::directionType::fwd, Controller1.Axis2.position(), vex::velocityUnits::pct);
+      double solveStart = vex::timer::systemHighResolution();
+      leftDriveMpc.setLimits(MAX_DRIVE_VOLTAGE, slewLimits.acceleration * slewScale, currentBudget.getMotorLimit("drive"));
+      rightDriveMpc.setLimits(MAX_DRIVE_VOLTAGE, slewLimits.acceleration * slewScale, currentBudget.getMotorLimit("drive"));
+      leftCommand = leftDriveMpc.update(leftDrivePredictor.getPrediction(), leftCommand) / MAX_DRIVE_VOLTAGE * 100;
+      rightCommand = rightDriveMpc.update(rightDrivePredictor.getPrediction(), rightCommand) / MAX_DRIVE_VOLTAGE * 100;
+      mpcMaxSolveTime = fmax(mpcMaxSolveTime, vex::timer::systemHighResolution() - solveStart);
+      leftDriveSlew.reset(leftCommand);
+      rightDriveSlew.reset(rightCommand);
     }
-    else if (driveConfig == LFRB)
+    else if (slewEnabled)
     {
-      leftFront.spin(vex::directionType::fwd, Controller1.Axis3.position(), vex::velocityUnits::pct);
-      rightBack.spin(vex::directionType::fwd, Controller1.Axis2.position(), vex::velocityUnits::pct);
+      leftDriveSlew.setLimits(slewLimits.acceleration * slewScale, slewLimits.deceleration * slewScale);
+      rightDriveSlew.setLimits(slewLimits.acceleration * slewScale, slewLimits.deceleration * slewScale);
+      leftCommand = leftDriveSlew.update(leftCommand);
+      rightCommand = rightDriveSlew.update(rightCommand);
     }
     else
     {
-      leftBack.spin(vex::directionType::fwd, Controller1.Axis3.position(), vex::velocityUnits::pct);
-      rightBack.spin(vex::directionType::fwd, Controller1.Axis2.position(), vex::velocityUnits::pct);
-      leftFront.spin(vex::directionType::fwd, Controller1.Axis3.position(), vex::velocityUnits::pct);
-      rightFront.spin(vex::directionType::fwd, Controller1.Axis2.position(), vex::velocityUnits::pct);
+      leftDriveSlew.reset(leftCommand);
+      rightDriveSlew.reset(rightCommand);
+    }
+    if (!mpcEnabled)
+    {
+      leftDriveMpc.reset(leftCommand / 100 * MAX_DRIVE_VOLTAGE);
+      rightDriveMpc.reset(rightCommand / 100 * MAX_DRIVE_VOLTAGE);
     }
 
-    // Clamp Controls
+    // Traction Control - a side whose wheels break loose is held at what the ground will take
+    tractionControl.apply(leftCommand, rightCommand);
+
+    // Drive Controls - each working motor follows its own side's stick, in battery compensated volts
+    driveKinematics.spin(leftCommand, rightCommand);
+
+    // Latency Estimation - each side's dead time is learned from the driver's own steps
+    leftDrivePredictor.setCommand(leftCommand);
+    rightDrivePredictor.setCommand(rightCommand);
+    driveStats.update();
+
+    // Clamp Controls - X toggles the clamp by hand, Y toggles automatic clamping on goal contact
     if (Controller1.ButtonX.pressing() && !clampLastState)
     {
-      clampState = !clampState;
+      autoClamp.toggle();
       clampLastState = true;
     }
     else if (!Controller1.ButtonX.pressing())
     {
       clampLastState = false;
     }
-    if (clampState)
+    if (Controller1.ButtonY.pressing() && !autoClampLastState)
     {
-      clamp.set(true);
+      autoClamp.setAutoEnabled(!autoClamp.isAutoEnabled());
+      autoClampLastState = true;
     }
-    else
+    else if (!Controller1.ButtonY.pressing())
+    {
+      autoClampLastState = false;
+    }
+
+    // Scoring Macro Controls - A starts the scoring sequence, A again or any manual intake, arm or clamp input cancels it
+    if (Controller1.ButtonA.pressing() && !scoringMacroLastState)
     {
-      clamp.set(false);
+      if (scoringMacro.isRunning())
+      {
+        scoringMacro.cancel();
+      }
+      else
+      {
+        scoringMacro.start();
+      }
+      scoringMacroLastState = true;
+    }
+    else if (!Controller1.ButtonA.pressing())
+    {
+      scoringMacroLastState = false;
     }
+    if (Controller1.ButtonL1.pressing() || Controller1.ButtonL2.pressing() || Controller1.ButtonR1.pressing() || Controller1.ButtonR2.pressing() ||
+        Controller1.ButtonUp.pressing() || Controller1.ButtonDown.pressing() || Controller1.ButtonX.pressing())
+    {
+      scoringMacro.cancel();
+    }
+    scoringMacro.update();
 
-    // Intake Controls
-    if (Controller1.ButtonL1.pressing())
+    // Intake Controls - each intake motor reverses briefly on its own to clear jams
+    double intakeVelocity = 0;
+    if (scoringMacro.isRunning())
     {
-      intakeMotors.spin(vex::directionType::fwd);
+      intakeVelocity = scoringMacro.getIntakeVelocity();
     }
-    else if (Controller1.ButtonL2.pressing())
+    else if (Controller1.ButtonL1.pressing())
     {
-      intakeMotors.spin(vex::directionType::rev);
+      intakeVelocity = 100;
     }
-    else
+    else if (Controller1.ButtonL2.pressing())
     {
-      intakeMotors.stop();
+      intakeVelocity = -100;
     }
+    leftIntakeJamDetector.update(intakeVelocity);
+    rightIntakeJamDetector.update(intakeVelocity);
 
-    // Arm Controls
-    if (Controller1.ButtonUp.pressing())
+    // Arm Controls - the scoring macro drives the arm while it runs
+    if (scoringMacro.isRunning())
+    {
+      // Arm targets are set by scoringMacro.update()
+    }
+    else if (Controller1.ButtonUp.pressing())
     {
       armMotors.spinToPosition(720, vex::rotationUnits::deg, true);
     }
@@ -0,0 +1,188 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       mpc-drive.cpp                                             */
+/*    Created:      10/18/2026                                                */
+/*    Description:  Model-predictive voltage control for one drive side; no   */
+/*                  VEX dependencies so it builds and runs unchanged on host  */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include <math.h>
+#include "mpc-drive.h"
+
+// Percent velocity a drive side settles at per volt with no load, 100% at 12 V
+const double VELOCITY_PER_VOLT = 100.0 / 12.0;
+// Ohms of motor winding resistance, so back-EMF headroom in volts over this is the current drawn
+const double MOTOR_RESISTANCE = 2.0;
+// Cost per squared percent of velocity error at every step of the horizon
+const double TRACKING_WEIGHT = 1;
+// Cost per squared volt, a light preference for the cheaper of two equally good plans
+const double VOLTAGE_WEIGHT = 0.01;
+// Cost per squared volt of change between steps, which keeps the plan from chattering
+const double SMOOTHING_WEIGHT = 0.2;
+
+/**
+ * @brief constructs an MpcDrive and sets up its horizon-wide quadratic program
+ * @details The side is modelled as first order: each tick velocity moves toward VELOCITY_PER_VOLT * volts by
+ * 1 - exp(-tick / timeConstant). Over HORIZON ticks every predicted velocity is then the free response of
+ * the current velocity plus a fixed linear combination of the planned voltages, so the cost and constraint
+ * matrices never change and the solver factors them once here. Only the starting velocity, reference and
+ * limits move the problem, and they only enter its linear term and bounds.
+ * @param newTimeConstant double seconds the side takes to reach 63% of a voltage step
+ * @param newTickTime double seconds between update() calls
+ * @date 10/18/2026
+ */
+MpcDrive::MpcDrive(double newTimeConstant, double newTickTime)
+{
+  decay = exp(-newTickTime / newTimeConstant);
+  inputGain = VELOCITY_PER_VOLT * (1 - decay);
+  lastVoltage = 0;
+  iterations = 0;
+
+  // response[k][j]: effect of the voltage planned at step j on the velocity at step k; freeResponse[k]: of the starting velocity
+  for (int k = 0; k <= HORIZON; k++)
+  {
+    freeResponse[k] = pow(decay, k);
+    for (int j = 0; j < HORIZON; j++)
+    {
+      response[k][j] = j < k ? pow(decay, k - 1 - j) * inputGain : 0;
+    }
+  }
+
+  // Cost 0.5 u'Pu: tracking over steps 1..HORIZON, voltage, and step to step smoothing
+  static double cost[HORIZON * HORIZON];
+  for (int i = 0; i < HORIZON; i++)
+  {
+    for (int j = 0; j < HORIZON; j++)
+    {
+      double tracking = 0;
+      for (int k = 1; k <= HORIZON; k++)
+      {
+        tracking += response[k][i] * response[k][j];
+      }
+      double smoothing = 0;
+      if (i == j)
+      {
+        smoothing = i < HORIZON - 1 ? 2 : 1;
+      }
+      else if (i - j == 1 || j - i == 1)
+      {
+        smoothing = -1;
+      }
+      cost[i * HORIZON + j] = 2 * (TRACKING_WEIGHT * tracking + (i == j ? VOLTAGE_WEIGHT : 0) + SMOOTHING_WEIGHT * smoothing);
+    }
+  }
+
+  // Rows: voltage at each step, velocity change over each step, back-EMF headroom (current) at each step
+  static double constraintMatrix[3 * HORIZON * HORIZON];
+  for (int k = 0; k < HORIZON; k++)
+  {
+    for (int j = 0; j < HORIZON; j++)
+    {
+      constraintMatrix[k * HORIZON + j] = k == j ? 1 : 0;
+      constraintMatrix[(HORIZON + k) * HORIZON + j] = response[k + 1][j] - response[k][j];
+      constraintMatrix[(2 * HORIZON + k) * HORIZON + j] = (k == j ? 1 : 0) - response[k][j] / VELOCITY_PER_VOLT;
+    }
+    rowFreeResponse[k] = 0;
+    rowFreeResponse[HORIZON + k] = freeResponse[k + 1] - freeResponse[k];
+    rowFreeResponse[2 * HORIZON + k] = -freeResponse[k] / VELOCITY_PER_VOLT;
+  }
+  setLimits(12, 100, 2.5);
+
+  ready = solver.setup(HORIZON, 3 * HORIZON, cost, constraintMatrix);
+}
+
+/**
+ * @brief sets the limits every planned step must respect
+ * @param newMaxVoltage double largest volts either way
+ * @param newMaxAcceleration double largest percent velocity change per tick either way
+ * @param newMaxCurrent double largest amps per motor either way, such as the current budget's share
+ * @date 10/18/2026
+ */
+void MpcDrive::setLimits(double newMaxVoltage, double newMaxAcceleration, double newMaxCurrent)
+{
+  for (int k = 0; k < HORIZON; k++)
+  {
+    rowLimit[k] = newMaxVoltage;
+    rowLimit[HORIZON + k] = newMaxAcceleration;
+    rowLimit[2 * HORIZON + k] = newMaxCurrent * MOTOR_RESISTANCE;
+  }
+}
+
+/**
+ * @brief plans the next HORIZON voltages toward the reference and returns the first one
+ * @details Runs in bounded time with no allocation: one warm started QpSolver::solve() on fixed-size arrays.
+ * If the solver is still short of tolerance when it runs out of iterations its last iterate is used and the
+ * next tick carries on from it; either way the voltage applied is clamped to satisfy every first-step limit.
+ * @relates usercontrol()
+ * @param velocity double measured (or predicted) side velocity in percent
+ * @param reference double percent velocity the side should reach and hold over the horizon
+ * @returns double volts to apply this tick
+ * @date 10/18/2026
+ */
+double MpcDrive::update(double velocity, double reference)
+{
+  if (!ready)
+  {
+    return reference / VELOCITY_PER_VOLT;
+  }
+
+  double linearCost[HORIZON];
+  for (int i = 0; i < HORIZON; i++)
+  {
+    double tracking = 0;
+    for (int k = 1; k <= HORIZON; k++)
+    {
+      tracking += response[k][i] * (freeResponse[k] * velocity - reference);
+    }
+    linearCost[i] = 2 * TRACKING_WEIGHT * tracking - (i == 0 ? 2 * SMOOTHING_WEIGHT * lastVoltage : 0);
+  }
+
+  double lowerBounds[3 * HORIZON];
+  double upperBounds[3 * HORIZON];
+  for (int row = 0; row < 3 * HORIZON; row++)
+  {
+    lowerBounds[row] = -rowLimit[row] - rowFreeResponse[row] * velocity;
+    upperBounds[row] = rowLimit[row] - rowFreeResponse[row] * velocity;
+  }
+
+  iterations = solver.solve(linearCost, lowerBounds, upperBounds);
+
+  // The first step's rows only involve its own voltage, so they reduce to bounds the applied voltage is held to exactly
+  double voltage = solver.getSolution()[0];
+  for (int row = 0; row < 3 * HORIZON; row += HORIZON)
+  {
+    double coefficient = row == HORIZON ? inputGain : 1;
+    voltage = fmin(fmax(voltage, lowerBounds[row] / coefficient), upperBounds[row] / coefficient);
+  }
+  lastVoltage = voltage;
+  return lastVoltage;
+}
+
+/**
+ * @brief tells the controller which voltage was applied last, when another mode has been driving
+ * @param voltage double volts applied last tick
+ * @date 10/18/2026
+ */
+void MpcDrive::reset(double voltage)
+{
+  lastVoltage = voltage;
+}
+
+/**
+ * @brief returns the solver iterations the last update() used
+ * @date 10/18/2026
+ */
+int MpcDrive::getIterations()
+{
+  return iterations;
+}
+
+/**
+ * @brief returns whether the last update() solved to tolerance
+ * @date 10/18/2026
+ */
+bool MpcDrive::isConverged()
+{
+  return solver.isConverged();
+}
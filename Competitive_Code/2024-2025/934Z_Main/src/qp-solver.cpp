@@ -0,0 +1,224 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       qp-solver.cpp                                             */
+/*    Created:      10/18/2026                                                */
+/*    Description:  Allocation-free ADMM quadratic program solver; no VEX     */
+/*                  dependencies so it builds and runs unchanged on the host  */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include <math.h>
+#include "qp-solver.h"
+
+// ADMM penalty on constraint violation, sized to the drive problem's cost scale; fixed so the factorization is computed once per setup()
+const double QP_RHO = 5;
+// Small proximal weight that keeps the factored matrix positive definite
+const double QP_SIGMA = 1e-6;
+// Over-relaxation, which roughly halves the iterations ADMM needs
+const double QP_ALPHA = 1.6;
+// Iterations allowed per solve; the last iterate is still feasible-ish and warm starts the next tick
+const int QP_MAX_ITERATIONS = 60;
+// Largest primal and dual residual accepted as converged
+const double QP_TOLERANCE = 1e-2;
+
+/**
+ * @brief constructs an empty QpSolver
+ * @date 10/18/2026
+ */
+QpSolver::QpSolver()
+{
+  variables = 0;
+  constraints = 0;
+  converged = false;
+}
+
+/**
+ * @brief stores the problem's fixed matrices and factors them once
+ * @details The problem is minimize 0.5 x'Px + q'x subject to l <= Ax <= u. P and A are fixed by setup();
+ * q, l and u may change on every solve() at no extra cost, which is what a receding horizon needs.
+ * The ADMM linear system P + sigma I + rho A'A is Cholesky factored here and reused by every iteration.
+ * The warm start is cleared.
+ * @param newVariables int size of x, at most MAX_VARIABLES
+ * @param newConstraints int rows of A, at most MAX_CONSTRAINTS
+ * @param newCost double row-major newVariables x newVariables positive semidefinite matrix P
+ * @param newConstraintMatrix double row-major newConstraints x newVariables matrix A
+ * @returns bool false if the sizes are too large or the matrix is not positive definite
+ * @date 10/18/2026
+ */
+bool QpSolver::setup(int newVariables, int newConstraints, const double *newCost, const double *newConstraintMatrix)
+{
+  if (newVariables > MAX_VARIABLES || newConstraints > MAX_CONSTRAINTS)
+  {
+    return false;
+  }
+  variables = newVariables;
+  constraints = newConstraints;
+  for (int i = 0; i < variables; i++)
+  {
+    for (int j = 0; j < variables; j++)
+    {
+      cost[i][j] = newCost[i * variables + j];
+    }
+    solution[i] = 0;
+  }
+  for (int i = 0; i < constraints; i++)
+  {
+    for (int j = 0; j < variables; j++)
+    {
+      constraintMatrix[i][j] = newConstraintMatrix[i * variables + j];
+    }
+    slack[i] = 0;
+    dual[i] = 0;
+  }
+
+  // Lower triangular Cholesky factor of P + sigma I + rho A'A
+  for (int i = 0; i < variables; i++)
+  {
+    for (int j = 0; j <= i; j++)
+    {
+      double sum = cost[i][j] + (i == j ? QP_SIGMA : 0);
+      for (int k = 0; k < constraints; k++)
+      {
+        sum += QP_RHO * constraintMatrix[k][i] * constraintMatrix[k][j];
+      }
+      for (int k = 0; k < j; k++)
+      {
+        sum -= factor[i][k] * factor[j][k];
+      }
+      if (i == j)
+      {
+        if (sum <= 0)
+        {
+          return false;
+        }
+        factor[i][i] = sqrt(sum);
+      }
+      else
+      {
+        factor[i][j] = sum / factor[j][j];
+      }
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief solves the factored system in place by forward then backward substitution
+ * @param vector double array of size variables, replaced by the solution
+ * @date 10/18/2026
+ */
+void QpSolver::solveFactored(double *vector)
+{
+  for (int i = 0; i < variables; i++)
+  {
+    for (int k = 0; k < i; k++)
+    {
+      vector[i] -= factor[i][k] * vector[k];
+    }
+    vector[i] /= factor[i][i];
+  }
+  for (int i = variables - 1; i >= 0; i--)
+  {
+    for (int k = i + 1; k < variables; k++)
+    {
+      vector[i] -= factor[k][i] * vector[k];
+    }
+    vector[i] /= factor[i][i];
+  }
+}
+
+/**
+ * @brief runs ADMM from the last solution until the residuals fall under QP_TOLERANCE or QP_MAX_ITERATIONS
+ * @details Each iteration solves one factored linear system, projects Ax onto [l, u] and updates the
+ * duals, so the work is bounded by QP_MAX_ITERATIONS * (variables^2 + 2 * constraints * variables)
+ * multiply-adds, about 130k for a 15 step horizon, and nothing is allocated.
+ * @param linearCost double array q of size variables
+ * @param lowerBounds double array l of size constraints
+ * @param upperBounds double array u of size constraints
+ * @returns int iterations used
+ * @date 10/18/2026
+ */
+int QpSolver::solve(const double *linearCost, const double *lowerBounds, const double *upperBounds)
+{
+  converged = false;
+  int iteration = 0;
+  while (iteration < QP_MAX_ITERATIONS && !converged)
+  {
+    iteration++;
+
+    // x~ = (P + sigma I + rho A'A)^-1 (sigma x - q + A'(rho z - y))
+    for (int i = 0; i < variables; i++)
+    {
+      previousSolution[i] = solution[i];
+      right[i] = QP_SIGMA * solution[i] - linearCost[i];
+      for (int k = 0; k < constraints; k++)
+      {
+        right[i] += constraintMatrix[k][i] * (QP_RHO * slack[k] - dual[k]);
+      }
+    }
+    solveFactored(right);
+
+    double primalResidual = 0;
+    for (int k = 0; k < constraints; k++)
+    {
+      double product = 0;
+      for (int i = 0; i < variables; i++)
+      {
+        product += constraintMatrix[k][i] * right[i];
+      }
+      double relaxed = QP_ALPHA * product + (1 - QP_ALPHA) * slack[k];
+      double newSlack = fmin(fmax(relaxed + dual[k] / QP_RHO, lowerBounds[k]), upperBounds[k]);
+      dual[k] += QP_RHO * (relaxed - newSlack);
+      slack[k] = newSlack;
+    }
+    for (int i = 0; i < variables; i++)
+    {
+      solution[i] = QP_ALPHA * right[i] + (1 - QP_ALPHA) * previousSolution[i];
+    }
+
+    // Converged once Ax sits on its projection and Px + q + A'y vanishes
+    for (int k = 0; k < constraints; k++)
+    {
+      double product = 0;
+      for (int i = 0; i < variables; i++)
+      {
+        product += constraintMatrix[k][i] * solution[i];
+      }
+      primalResidual = fmax(primalResidual, fabs(product - slack[k]));
+    }
+    double dualResidual = 0;
+    for (int i = 0; i < variables; i++)
+    {
+      double gradient = linearCost[i];
+      for (int j = 0; j < variables; j++)
+      {
+        gradient += cost[i][j] * solution[j];
+      }
+      for (int k = 0; k < constraints; k++)
+      {
+        gradient += constraintMatrix[k][i] * dual[k];
+      }
+      dualResidual = fmax(dualResidual, fabs(gradient));
+    }
+    converged = primalResidual < QP_TOLERANCE && dualResidual < QP_TOLERANCE;
+  }
+  return iteration;
+}
+
+/**
+ * @brief returns the last solution, valid until the next solve()
+ * @date 10/18/2026
+ */
+const double *QpSolver::getSolution()
+{
+  return solution;
+}
+
+/**
+ * @brief returns whether the last solve() met QP_TOLERANCE within QP_MAX_ITERATIONS
+ * @date 10/18/2026
+ */
+bool QpSolver::isConverged()
+{
+  return converged;
+}
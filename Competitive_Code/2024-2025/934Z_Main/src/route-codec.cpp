@@ -0,0 +1,219 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       route-codec.cpp                                           */
+/*    Created:      10/18/2026                                                */
+/*    Description:  Delta and varint compression of routes; no VEX            */
+/*                  dependencies so the route compiler shares it on the host  */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include <math.h>
+#include "route-codec.h"
+
+// RouteTable stream, one entry per record:
+//   varint  time since the last record in msec, shifted left one, low bit set if the flags changed
+//   byte    the new flags, only if they changed
+//   byte    mask of the channels whose velocity changed, bit i for channel i
+//   varint  for each masked channel, the zigzag-encoded change in velocity in 1/ROUTE_POSITION_SCALE degrees
+// Each channel's velocity is its position change over the last record, so steady motion costs nothing and
+// a smooth route mostly stores one-byte changes. The first record's change is its whole position, and its
+// velocity is then cleared, since going from 0 to the start position is not motion.
+
+/**
+ * @brief constructs an empty RouteEncoder
+ * @date 10/18/2026
+ */
+RouteEncoder::RouteEncoder()
+{
+  records = 0;
+  lastTime = 0;
+  lastFlags = 0;
+  for (int i = 0; i < NUMBER_OF_ROUTE_CHANNELS; i++)
+  {
+    positions[i] = 0;
+    deltas[i] = 0;
+  }
+}
+
+/**
+ * @brief appends a value seven bits at a time, low bits first, with the high bit marking more to come
+ * @param value uint32_t value to append
+ * @date 10/18/2026
+ */
+void RouteEncoder::addVarint(uint32_t value)
+{
+  while (value >= 0x80)
+  {
+    data.push_back((value & 0x7F) | 0x80);
+    value >>= 7;
+  }
+  data.push_back(value);
+}
+
+/**
+ * @brief appends the next record, which must not be earlier than the last one
+ * @param record RouteRecord to compress; positions are rounded to 1/ROUTE_POSITION_SCALE degrees
+ * @date 10/18/2026
+ */
+void RouteEncoder::add(const RouteRecord &record)
+{
+  bool flagsChanged = record.flags != lastFlags;
+  addVarint(((record.time - lastTime) << 1) | (flagsChanged ? 1 : 0));
+  if (flagsChanged)
+  {
+    data.push_back(record.flags);
+  }
+
+  int32_t changes[NUMBER_OF_ROUTE_CHANNELS];
+  uint8_t mask = 0;
+  for (int i = 0; i < NUMBER_OF_ROUTE_CHANNELS; i++)
+  {
+    int32_t position = lround(record.positions[i] * ROUTE_POSITION_SCALE);
+    int32_t delta = position - positions[i];
+    changes[i] = delta - deltas[i];
+    if (changes[i] != 0)
+    {
+      mask |= 1 << i;
+    }
+    positions[i] = position;
+    deltas[i] = records == 0 ? 0 : delta;
+  }
+  data.push_back(mask);
+  for (int i = 0; i < NUMBER_OF_ROUTE_CHANNELS; i++)
+  {
+    if (changes[i] != 0)
+    {
+      addVarint(((uint32_t)changes[i] << 1) ^ (uint32_t)(changes[i] >> 31));
+    }
+  }
+
+  lastTime = record.time;
+  lastFlags = record.flags;
+  records++;
+}
+
+/**
+ * @brief returns the compressed stream so far
+ * @date 10/18/2026
+ */
+const std::vector<uint8_t> &RouteEncoder::getData()
+{
+  return data;
+}
+
+/**
+ * @brief returns the records added so far
+ * @date 10/18/2026
+ */
+int RouteEncoder::getRecords()
+{
+  return records;
+}
+
+/**
+ * @brief constructs a RouteTableSource at the start of a table, which must outlive it
+ * @param newTable RouteTable written by tools/route-compiler.cpp
+ * @date 10/18/2026
+ */
+RouteTableSource::RouteTableSource(const RouteTable &newTable)
+{
+  table = &newTable;
+  offset = 0;
+  records = 0;
+  time = 0;
+  flags = 0;
+  for (int i = 0; i < NUMBER_OF_ROUTE_CHANNELS; i++)
+  {
+    positions[i] = 0;
+    deltas[i] = 0;
+  }
+}
+
+/**
+ * @brief reads one varint from the table
+ * @date 10/18/2026
+ */
+uint32_t RouteTableSource::readVarint()
+{
+  uint32_t value = 0;
+  int shift = 0;
+  while (offset < table->size)
+  {
+    uint8_t byte = table->data[offset];
+    offset++;
+    value |= (uint32_t)(byte & 0x7F) << shift;
+    if (byte < 0x80)
+    {
+      break;
+    }
+    shift += 7;
+  }
+  return value;
+}
+
+/**
+ * @brief decodes the next record
+ * @details Decoding is a few byte reads and additions per channel with no allocation, well under the cost
+ * of one motor command, so routes can be decoded inside the playback tick instead of ahead of time.
+ * @param record RouteRecord set to the next record
+ * @returns bool false once every record has been read
+ * @date 10/18/2026
+ */
+bool RouteTableSource::next(RouteRecord &record)
+{
+  if (records >= table->records || offset >= table->size)
+  {
+    return false;
+  }
+
+  uint32_t timeField = readVarint();
+  time += timeField >> 1;
+  if (timeField & 1)
+  {
+    flags = table->data[offset];
+    offset++;
+  }
+  uint8_t mask = table->data[offset];
+  offset++;
+  for (int i = 0; i < NUMBER_OF_ROUTE_CHANNELS; i++)
+  {
+    int32_t change = 0;
+    if (mask & (1 << i))
+    {
+      uint32_t zigzag = readVarint();
+      change = (int32_t)(zigzag >> 1) ^ -(int32_t)(zigzag & 1);
+    }
+    int32_t delta = deltas[i] + change;
+    positions[i] += delta;
+    deltas[i] = records == 0 ? 0 : delta;
+    record.positions[i] = (float)positions[i] / ROUTE_POSITION_SCALE;
+  }
+  record.time = time;
+  record.flags = flags;
+  for (int i = 0; i < 3; i++)
+  {
+    record.reserved[i] = 0;
+  }
+  records++;
+  return true;
+}
+
+/**
+ * @brief adds bytes to a route checksum
+ * @details 32-bit FNV-1a: tiny, needs no table, and catches any changed or reordered byte in a route well
+ * enough to tell a corrupt or stale route from the one the compiler wrote. Start from ROUTE_CHECKSUM_SEED;
+ * a file can be checked a chunk at a time by feeding each result back in.
+ * @param checksum uint32_t checksum of the bytes so far
+ * @param data const uint8_t* next bytes
+ * @param size int number of bytes
+ * @returns uint32_t checksum including the new bytes
+ * @date 10/18/2026
+ */
+uint32_t updateRouteChecksum(uint32_t checksum, const uint8_t *data, int size)
+{
+  for (int i = 0; i < size; i++)
+  {
+    checksum = (checksum ^ data[i]) * 16777619u;
+  }
+  return checksum;
+}
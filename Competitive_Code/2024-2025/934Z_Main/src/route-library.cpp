@@ -0,0 +1,168 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       route-library.cpp                                         */
+/*    Created:      10/18/2026                                                */
+/*    Description:  Registry of autonomous routes for the auton selector      */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include "vex.h"
+#include "route-library.h"
+
+using namespace vex;
+
+// Route with no records, which the table source starts on and a route that does nothing plays
+const RouteTable EMPTY_ROUTE = {NULL, 0, 0, 0, ROUTE_CHECKSUM_SEED};
+
+/**
+ * @brief constructs a RouteLibrary with nothing selected; no route is read until one is
+ * @param newEntries const RouteEntry* routes in selector order, which must outlive the library
+ * @param newCount int number of entries
+ * @date 10/18/2026
+ */
+RouteLibrary::RouteLibrary(const RouteEntry *newEntries, int newCount)
+    : tableSource(EMPTY_ROUTE), mirroredFileSource(fileSource), mirroredTableSource(tableSource)
+{
+  entries = newEntries;
+  count = newCount;
+  selected = -1;
+  verified = false;
+  fromCard = false;
+  duration = 0;
+  checksum = 0;
+}
+
+/**
+ * @brief returns the number of routes the selector cycles through
+ * @date 10/18/2026
+ */
+int RouteLibrary::getCount()
+{
+  return count;
+}
+
+/**
+ * @brief returns a route's entry by selector index
+ * @param index int from 0 to getCount() - 1
+ * @date 10/18/2026
+ */
+const RouteEntry &RouteLibrary::getEntry(int index)
+{
+  return entries[index];
+}
+
+/**
+ * @brief selects a route by index, checking it and finding its duration and checksum
+ * @details This is where a route is first touched, while the robot waits for the match, so playback never
+ * pays for it. A route on the SD card is read through once (see RouteFileSource::inspect()) and replaces
+ * the built-in one if it is a valid route; its checksum is shown so the team can tell which recording is on
+ * the card. A built-in route's checksum is recomputed over the linked table and must match the one the route
+ * compiler stamped into it, or the route is refused rather than played corrupted or half-updated.
+ * @relates autonSelection()
+ * @param index int from 0 to getCount() - 1; out of range indices select nothing
+ * @date 10/18/2026
+ */
+void RouteLibrary::select(int index)
+{
+  selected = index >= 0 && index < count ? index : -1;
+  verified = false;
+  fromCard = false;
+  duration = 0;
+  checksum = 0;
+  if (selected < 0)
+  {
+    return;
+  }
+
+  const RouteEntry &entry = entries[selected];
+  if (entry.fileName != NULL && RouteFileSource::inspect(entry.fileName, duration, checksum))
+  {
+    fromCard = true;
+    verified = true;
+  }
+  else if (entry.table != NULL)
+  {
+    duration = entry.table->duration;
+    checksum = updateRouteChecksum(ROUTE_CHECKSUM_SEED, entry.table->data, entry.table->size);
+    verified = checksum == entry.table->checksum;
+  }
+  else
+  {
+    verified = true;
+  }
+  printf("Route library: %s, %.1f sec, checksum %08lX %s%s\n", entry.name, duration / 1000.0, (unsigned long)checksum,
+         verified ? "OK" : "BAD", fromCard ? " from SD card" : "");
+}
+
+/**
+ * @brief returns the selected route's index, or -1 if none is selected
+ * @date 10/18/2026
+ */
+int RouteLibrary::getSelected()
+{
+  return selected;
+}
+
+/**
+ * @brief returns whether the selected route passed its checks and will play
+ * @date 10/18/2026
+ */
+bool RouteLibrary::isVerified()
+{
+  return verified;
+}
+
+/**
+ * @brief returns whether the selected route will play from the SD card rather than the built-in table
+ * @date 10/18/2026
+ */
+bool RouteLibrary::isFromCard()
+{
+  return fromCard;
+}
+
+/**
+ * @brief returns the selected route's estimated duration in seconds, its first record to its last as recorded
+ * @date 10/18/2026
+ */
+double RouteLibrary::getDuration()
+{
+  return duration / 1000.0;
+}
+
+/**
+ * @brief returns the selected route's checksum
+ * @date 10/18/2026
+ */
+uint32_t RouteLibrary::getChecksum()
+{
+  return checksum;
+}
+
+/**
+ * @brief opens the selected route for playback, mirrored if its entry asks for it
+ * @details An SD card route is streamed (see route-sources.cpp), so opening costs the same for any length.
+ * If the card route chosen at selection cannot be opened now, the built-in table is played instead when it
+ * passed its checksum.
+ * @relates autonomous()
+ * @returns RouteSource* source to play, or NULL if nothing is selected, the route does nothing or it failed its checks
+ * @date 10/18/2026
+ */
+RouteSource *RouteLibrary::open()
+{
+  if (selected < 0 || !verified)
+  {
+    return NULL;
+  }
+  const RouteEntry &entry = entries[selected];
+  if (fromCard && fileSource.open(entry.fileName))
+  {
+    return entry.mirrored ? (RouteSource *)&mirroredFileSource : &fileSource;
+  }
+  if (entry.table == NULL || (fromCard && updateRouteChecksum(ROUTE_CHECKSUM_SEED, entry.table->data, entry.table->size) != entry.table->checksum))
+  {
+    return NULL;
+  }
+  tableSource = RouteTableSource(*entry.table);
+  return entry.mirrored ? (RouteSource *)&mirroredTableSource : &tableSource;
+}
@@ -0,0 +1,152 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       route-model.cpp                                           */
+/*    Created:      10/18/2026                                                */
+/*    Description:  Robot geometry and motion limits shared by the route      */
+/*                  passes; no VEX dependencies so the host tools share it    */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include <math.h>
+#include "route-model.h"
+
+const double ROUTE_DRIVE_DEGREES_PER_INCH = 600 / 24.25;
+const double ROUTE_DRIVE_DEGREES_PER_TURN_DEGREE = 257 / 90.0;
+// Green drive and intake motors at 200 rpm, red arm motors at 100 rpm
+const double ROUTE_CHANNEL_MAX_VELOCITY[NUMBER_OF_ROUTE_CHANNELS] = {1200, 1200, 1200, 1200, 600, 600, 1200, 1200};
+// Full speed in about 0.2 sec, what the drive reaches with its slew limits at full stick
+const double ROUTE_CHANNEL_MAX_ACCELERATION[NUMBER_OF_ROUTE_CHANNELS] = {6000, 6000, 6000, 6000, 3000, 3000, 6000, 6000};
+// Reaching the maximum acceleration takes the 2.5 A the current budget allows each motor
+const double ROUTE_CHANNEL_ACCELERATION_PER_AMP[NUMBER_OF_ROUTE_CHANNELS] = {2400, 2400, 2400, 2400, 1200, 1200, 2400, 2400};
+// Ohms, so back-EMF headroom in volts over this is the current a motor can draw at speed
+const double ROUTE_MOTOR_RESISTANCE = 2.0;
+const double ROUTE_MAX_VOLTAGE = 12.0;
+
+/**
+ * @brief returns one side's drive position in motor degrees, the mean of its front and back channels
+ * @param record RouteRecord to read
+ * @param left bool true for the left side
+ * @date 10/18/2026
+ */
+double getSidePosition(const RouteRecord &record, bool left)
+{
+  if (left)
+  {
+    return (record.positions[LEFT_FRONT_CHANNEL] + record.positions[LEFT_BACK_CHANNEL]) / 2;
+  }
+  return (record.positions[RIGHT_FRONT_CHANNEL] + record.positions[RIGHT_BACK_CHANNEL]) / 2;
+}
+
+/**
+ * @brief finds a channel's position and velocity at a time between two records, the way RoutePlayer plays them
+ * @details Cubic Hermite interpolation with Catmull-Rom tangents taken from the neighbouring records, so
+ * position and velocity are both continuous from one segment to the next and a motor never has to stop at
+ * a record. Uneven record spacing is allowed. At the ends of a route the end record is passed as its own
+ * neighbour. RouteSimplifier checks dropped records with this too, so its tolerances hold during playback.
+ * @param before RouteRecord the record before first, or first itself at the start of a route
+ * @param first RouteRecord the record at or before time
+ * @param last RouteRecord the record at or after time
+ * @param after RouteRecord the record after last, or last itself at the end of a route
+ * @param channel int index from the RouteChannels enum
+ * @param time double route time in milliseconds, held between first and last
+ * @param position double set to the route's position in degrees
+ * @param velocity double set to the route's velocity in degrees per second
+ * @date 10/18/2026
+ */
+void interpolateChannel(const RouteRecord &before, const RouteRecord &first, const RouteRecord &last, const RouteRecord &after,
+                        int channel, double time, double &position, double &velocity)
+{
+  double t0 = before.time;
+  double t1 = first.time;
+  double t2 = last.time;
+  double t3 = after.time;
+  double p0 = before.positions[channel];
+  double p1 = first.positions[channel];
+  double p2 = last.positions[channel];
+  double p3 = after.positions[channel];
+  double span = t2 - t1;
+  if (span <= 0)
+  {
+    position = p2;
+    velocity = 0;
+    return;
+  }
+
+  double startSlope = t2 > t0 ? (p2 - p0) / (t2 - t0) : 0;
+  double endSlope = t3 > t1 ? (p3 - p1) / (t3 - t1) : 0;
+  double s = fmin(fmax((time - t1) / span, 0), 1);
+  double s2 = s * s;
+  double s3 = s2 * s;
+  position = (2 * s3 - 3 * s2 + 1) * p1 + (s3 - 2 * s2 + s) * span * startSlope + (-2 * s3 + 3 * s2) * p2 + (s3 - s2) * span * endSlope;
+  double slope = ((6 * s2 - 6 * s) * p1 + (3 * s2 - 4 * s + 1) * span * startSlope + (-6 * s2 + 6 * s) * p2 + (3 * s2 - 2 * s) * span * endSlope) / span;
+  velocity = slope * 1000;
+}
+
+/**
+ * @brief constructs RouteOdometry at the origin
+ * @date 10/18/2026
+ */
+RouteOdometry::RouteOdometry()
+{
+  pose.x = 0;
+  pose.y = 0;
+  pose.heading = 0;
+  lastLeft = 0;
+  lastRight = 0;
+}
+
+/**
+ * @brief puts the robot at the origin, facing +y, at a route's first record
+ * @param record RouteRecord the route starts at
+ * @date 10/18/2026
+ */
+void RouteOdometry::reset(const RouteRecord &record)
+{
+  RoutePose origin = {0, 0, 0};
+  reset(record, origin);
+}
+
+/**
+ * @brief puts the robot at a given pose at a record partway through a route
+ * @param record RouteRecord the pose was reached at
+ * @param startPose RoutePose the robot is at
+ * @date 10/18/2026
+ */
+void RouteOdometry::reset(const RouteRecord &record, RoutePose startPose)
+{
+  pose = startPose;
+  lastLeft = getSidePosition(record, true);
+  lastRight = getSidePosition(record, false);
+}
+
+/**
+ * @brief advances the pose to the next record
+ * @details Tank drive dead reckoning with the drive()/turn() benchmarks: the mean of the sides' travel
+ * moves the robot along the heading halfway through the step, and half their difference turns it.
+ * @param record RouteRecord the robot has moved to
+ * @returns RoutePose the new pose
+ * @date 10/18/2026
+ */
+RoutePose RouteOdometry::update(const RouteRecord &record)
+{
+  double left = getSidePosition(record, true);
+  double right = getSidePosition(record, false);
+  double distance = (left - lastLeft + right - lastRight) / 2 / ROUTE_DRIVE_DEGREES_PER_INCH;
+  double turn = (left - lastLeft - (right - lastRight)) / 2 / ROUTE_DRIVE_DEGREES_PER_TURN_DEGREE;
+  double midHeading = (pose.heading + turn / 2) * M_PI / 180;
+  pose.x += distance * sin(midHeading);
+  pose.y += distance * cos(midHeading);
+  pose.heading += turn;
+  lastLeft = left;
+  lastRight = right;
+  return pose;
+}
+
+/**
+ * @brief returns the pose at the last record
+ * @date 10/18/2026
+ */
+RoutePose RouteOdometry::getPose()
+{
+  return pose;
+}
@@ -0,0 +1,393 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       route-player.cpp                                          */
+/*    Created:      10/18/2026                                                */
+/*    Description:  Closed-loop interpolating playback of recorded routes     */
+/*                  and their clamp events                                    */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include "vex.h"
+#include "route-player.h"
+
+using namespace vex;
+
+// Degrees per second of extra velocity commanded per degree a motor is behind its interpolated target
+const double PLAYBACK_POSITION_GAIN = 5;
+// Percent velocity motors settle onto the route's final positions with once it ends
+const double PLAYBACK_HOLD_VELOCITY = 50;
+// Degrees per second of turn commanded per degree of heading error and per inch of cross-track error at speed
+const double PLAYBACK_HEADING_GAIN = 5;
+const double PLAYBACK_CROSS_TRACK_GAIN = 10;
+// Inches per second of route speed at which the cross-track correction reaches full strength
+const double PLAYBACK_CROSS_TRACK_SPEED = 12;
+// Degrees per second a drive side must be scheduled to move for its lag to count
+const double PLAYBACK_MOVING_VELOCITY = 50;
+// Drive degrees of lag tolerated before the schedule slows, and schedule rate lost per degree beyond
+const double PLAYBACK_LAG_TOLERANCE = 20;
+const double PLAYBACK_LAG_GAIN = 0.01;
+// Slowest the schedule runs however far the robot lags, so a stalled robot still finishes the route
+const double PLAYBACK_MIN_RATE = 0.5;
+
+/**
+ * @brief constructs an idle RoutePlayer with no channels
+ * @param newAutoClamp AutoClamp the clamp is set through from each record's flags
+ * @param newDriveKinematics DriveKinematics that knows which drive motors still work and the speed they allow
+ * @param newBatteryCompensation BatteryCompensation whose scale tells how much of top speed the battery still gives
+ * @date 10/18/2026
+ */
+RoutePlayer::RoutePlayer(AutoClamp &newAutoClamp, DriveKinematics &newDriveKinematics, BatteryCompensation &newBatteryCompensation)
+    : autoClamp(newAutoClamp), driveKinematics(newDriveKinematics), batteryCompensation(newBatteryCompensation)
+{
+  source = NULL;
+  playedFlags = 0;
+  startTime = 0;
+  routeTime = 0;
+  lastTickTime = 0;
+  rate = 1;
+  crossTrackSquares = 0;
+  stats = RouteTrackingStats();
+  haveNext = false;
+  playing = false;
+  for (int i = 0; i < NUMBER_OF_ROUTE_CHANNELS; i++)
+  {
+    offsets[i] = 0;
+  }
+}
+
+/**
+ * @brief adds the next motor channel, in RouteChannels order; motors past NUMBER_OF_ROUTE_CHANNELS are ignored
+ * @param motor VEX V5 motor driven from its channel of the route
+ * @date 10/18/2026
+ */
+void RoutePlayer::addMotor(vex::motor motor)
+{
+  if (motors.size() < NUMBER_OF_ROUTE_CHANNELS)
+  {
+    motors.push_back(motor);
+  }
+}
+
+/**
+ * @brief starts playing a route from its first record
+ * @details Only the first three records are read here, so starting costs the same for any route length.
+ * The route is played relative to where each motor is now: a route recorded partway through driver
+ * control starts from its own first positions, not from wherever the encoders were zeroed. The clamp is
+ * put in the state it was recorded in, and the tracking statistics start over.
+ * @relates autonomous()
+ * @param newSource RouteSource with the route's records, which must outlive playback
+ * @returns bool false if the source has no records
+ * @date 10/18/2026
+ */
+bool RoutePlayer::start(RouteSource &newSource)
+{
+  source = &newSource;
+  RouteRecord first;
+  if (!source->next(first))
+  {
+    playing = false;
+    return false;
+  }
+  window[0] = first;
+  window[1] = first;
+  window[2] = first;
+  haveNext = source->next(window[2]) && source->next(window[3]);
+  if (!haveNext)
+  {
+    window[3] = window[2];
+  }
+
+  for (int i = 0; i < (int)motors.size(); i++)
+  {
+    offsets[i] = motors[i].position(vex::rotationUnits::deg) - first.positions[i];
+  }
+  startTime = first.time;
+  routeTime = first.time;
+  lastTickTime = 0;
+  rate = 1;
+  playedFlags = ~first.flags;
+  playEvents(first);
+  targetOdometry.reset(first);
+  actualOdometry.reset(first);
+  stats = RouteTrackingStats();
+  crossTrackSquares = 0;
+  playTimer.clear();
+  playing = true;
+  return true;
+}
+
+/**
+ * @brief slides the four record window one record later, pulling the next record from the source
+ * @details Once the source runs dry the last record is repeated as window[3] and haveNext is cleared, which
+ * marks window[2] as the route's final record.
+ * @date 10/18/2026
+ */
+void RoutePlayer::advance()
+{
+  window[0] = window[1];
+  window[1] = window[2];
+  window[2] = window[3];
+  haveNext = source->next(window[3]);
+  if (!haveNext)
+  {
+    window[3] = window[2];
+  }
+}
+
+/**
+ * @brief sets the clamp to a record's flags if they differ from the last ones played
+ * @details Clamp changes are recorded as their own records the moment they happen (see RouteRecorder::poll()),
+ * so firing on the record the route has just reached puts each change at the same point in the drive's
+ * motion as it was recorded, within one playback tick. The clamp is set through AutoClamp, which keeps
+ * running during autonomous, so it always knows whether a goal is held: a goal the route releases while
+ * it still touches the sensor is locked out rather than grabbed again, and a goal AutoClamp grabbed first
+ * is really released when the route lets go.
+ * @param record RouteRecord the route has reached
+ * @date 10/18/2026
+ */
+void RoutePlayer::playEvents(const RouteRecord &record)
+{
+  if (record.flags == playedFlags)
+  {
+    return;
+  }
+  if ((record.flags ^ playedFlags) & ROUTE_CLAMP_EXTENDED)
+  {
+    autoClamp.setClamped((record.flags & ROUTE_CLAMP_EXTENDED) != 0);
+  }
+  playedFlags = record.flags;
+}
+
+/**
+ * @brief drives every channel along the route, correcting the drive's drift, and slows the schedule while the robot lags
+ * @details Each tick the targets interpolated between records (see interpolateChannel()) are compared with
+ * the encoders. Every motor is commanded the route velocity as feedforward plus a correction, through its
+ * own velocity controller:
+ * - Arm and intake motors correct PLAYBACK_POSITION_GAIN times their own position error.
+ * - The drive is corrected as a robot, not as four motors. Both the route and the encoders are dead
+ *   reckoned into poses (see route-model.cpp), and the pose error is split along the route's heading.
+ *   Along-track error drives both sides together at PLAYBACK_POSITION_GAIN. Heading error and
+ *   cross-track error steer the sides apart. Cross-track error is only fixable by driving, so it fades
+ *   out as the route slows to a stop and flips sign when driving backwards. Encoders that end up on
+ *   their targets can still have taken a different path to get there, say one side lagging through a
+ *   turn, and only the pose shows that. Both poses come from the same encoders, so wheel slip itself is
+ *   not seen: only the encoders' path history diverging from the route's is corrected.
+ * - Lag is handled by time, not effort. The schedule runs on its own clock, and while the drive sides
+ *   are behind where they should be in the direction they are moving, beyond PLAYBACK_LAG_TOLERANCE,
+ *   that clock slows down to no less than PLAYBACK_MIN_RATE. The feedforward slows with it. Errors
+ *   no longer pile up into a lunge to catch up, and clamp events stay in step with the drive because
+ *   they run on the same clock.
+ * - A lost drive motor is handled like driver control handles it (see drive-kinematics.cpp). It is not
+ *   commanded, its side is tracked on the motor still working there, and the schedule runs no faster than
+ *   the degraded speed limit, so the whole route slows together instead of the drive falling behind it.
+ * - Battery charge is handled the same way. The motors run in velocity mode, so their own controllers
+ *   hold the route's speeds at any charge while there is voltage to spare. A sagging battery lowers top
+ *   speed in proportion to its voltage (1 / BatteryCompensation::getScale() of it), and a route retimed
+ *   close to top speed would saturate there, one side at a time. The schedule is slowed just enough for
+ *   every channel to stay within the speed the battery gives, so the path is kept and only the timing
+ *   stretches.
+ * The errors are accumulated into RouteTrackingStats, printed when the route ends.
+ * @relates autonomous()
+ * @returns bool true while the route is still playing
+ * @date 10/18/2026
+ */
+bool RoutePlayer::update()
+{
+  if (!playing)
+  {
+    return false;
+  }
+
+  driveKinematics.update();
+  double now = playTimer.time(vex::timeUnits::msec);
+  routeTime += (now - lastTickTime) * rate;
+  lastTickTime = now;
+  stats.timeShift = now - (routeTime - startTime);
+  while (routeTime >= window[2].time)
+  {
+    if (!haveNext)
+    {
+      playEvents(window[2]);
+      for (int i = 0; i < (int)motors.size(); i++)
+      {
+        if (!isLostDriveMotor(i))
+        {
+          motors[i].spinToPosition(window[2].positions[i] + offsets[i], vex::rotationUnits::deg, PLAYBACK_HOLD_VELOCITY * (i <= RIGHT_BACK_CHANNEL ? driveKinematics.getSpeedLimit() : 1), vex::velocityUnits::pct, false);
+        }
+      }
+      finish();
+      return false;
+    }
+    advance();
+    playEvents(window[1]);
+  }
+
+  RouteRecord target = window[1];
+  RouteRecord actual = window[1];
+  double positions[NUMBER_OF_ROUTE_CHANNELS];
+  double velocities[NUMBER_OF_ROUTE_CHANNELS];
+  for (int i = 0; i < (int)motors.size(); i++)
+  {
+    interpolateChannel(window[0], window[1], window[2], window[3], i, routeTime, positions[i], velocities[i]);
+    target.positions[i] = positions[i];
+    actual.positions[i] = motors[i].position(vex::rotationUnits::deg) - offsets[i];
+  }
+  stats.ticks++;
+
+  // A lost drive motor's encoder means nothing, so its side is tracked on its partner, or on the route if both are lost
+  bool trackingDrive = motors.size() > RIGHT_BACK_CHANNEL;
+  for (int i = LEFT_FRONT_CHANNEL; trackingDrive && i <= RIGHT_BACK_CHANNEL; i++)
+  {
+    int partner = i == LEFT_FRONT_CHANNEL ? LEFT_BACK_CHANNEL : i == LEFT_BACK_CHANNEL ? LEFT_FRONT_CHANNEL : i == RIGHT_FRONT_CHANNEL ? RIGHT_BACK_CHANNEL : RIGHT_FRONT_CHANNEL;
+    if (isLostDriveMotor(i))
+    {
+      actual.positions[i] = isLostDriveMotor(partner) ? target.positions[i] : actual.positions[partner];
+    }
+  }
+
+  // Drive pose errors split along and across the route's heading, degrees clockwise from +y
+  double alongCorrection = 0;
+  double steering = 0;
+  double lag = 0;
+  int movingSides = 0;
+  if (trackingDrive)
+  {
+    RoutePose targetPose = targetOdometry.update(target);
+    RoutePose actualPose = actualOdometry.update(actual);
+    double heading = targetPose.heading * M_PI / 180;
+    double xError = targetPose.x - actualPose.x;
+    double yError = targetPose.y - actualPose.y;
+    double alongTrack = xError * sin(heading) + yError * cos(heading);
+    double crossTrack = xError * cos(heading) - yError * sin(heading);
+    double headingError = targetPose.heading - actualPose.heading;
+
+    double speed = (velocities[LEFT_FRONT_CHANNEL] + velocities[LEFT_BACK_CHANNEL] + velocities[RIGHT_FRONT_CHANNEL] + velocities[RIGHT_BACK_CHANNEL]) / 4 / ROUTE_DRIVE_DEGREES_PER_INCH;
+    double crossTrackStrength = fmin(fabs(speed) / PLAYBACK_CROSS_TRACK_SPEED, 1) * (speed < 0 ? -1 : 1);
+    alongCorrection = PLAYBACK_POSITION_GAIN * alongTrack * ROUTE_DRIVE_DEGREES_PER_INCH;
+    steering = (PLAYBACK_HEADING_GAIN * headingError + PLAYBACK_CROSS_TRACK_GAIN * crossTrackStrength * crossTrack) * ROUTE_DRIVE_DEGREES_PER_TURN_DEGREE;
+
+    for (int side = 0; side < 2; side++)
+    {
+      bool left = side == 0;
+      double sideVelocity = left ? (velocities[LEFT_FRONT_CHANNEL] + velocities[LEFT_BACK_CHANNEL]) / 2 : (velocities[RIGHT_FRONT_CHANNEL] + velocities[RIGHT_BACK_CHANNEL]) / 2;
+      if (fabs(sideVelocity) > PLAYBACK_MOVING_VELOCITY)
+      {
+        lag += (getSidePosition(target, left) - getSidePosition(actual, left)) * (sideVelocity < 0 ? -1 : 1);
+        movingSides++;
+      }
+    }
+
+    crossTrackSquares += crossTrack * crossTrack;
+    stats.rmsCrossTrack = sqrt(crossTrackSquares / stats.ticks);
+    stats.maxCrossTrack = fmax(stats.maxCrossTrack, fabs(crossTrack));
+    stats.maxAlongTrack = fmax(stats.maxAlongTrack, fabs(alongTrack));
+    stats.maxHeadingError = fmax(stats.maxHeadingError, fabs(headingError));
+  }
+  if (movingSides > 0)
+  {
+    lag /= movingSides;
+  }
+  rate = fmin(fmax(1 - PLAYBACK_LAG_GAIN * (lag - PLAYBACK_LAG_TOLERANCE), PLAYBACK_MIN_RATE), 1);
+  if (trackingDrive)
+  {
+    rate = fmin(rate, driveKinematics.getSpeedLimit());
+  }
+  double availableSpeed = fmin(1 / batteryCompensation.getScale(), 1);
+  double routeSpeed = 0;
+  for (int i = 0; i < (int)motors.size(); i++)
+  {
+    routeSpeed = fmax(routeSpeed, fabs(velocities[i]) / ROUTE_CHANNEL_MAX_VELOCITY[i]);
+  }
+  if (routeSpeed > availableSpeed)
+  {
+    rate = fmin(rate, availableSpeed / routeSpeed);
+  }
+
+  for (int i = 0; i < (int)motors.size(); i++)
+  {
+    if (isLostDriveMotor(i))
+    {
+      continue;
+    }
+    double correction;
+    if (trackingDrive && i <= RIGHT_BACK_CHANNEL)
+    {
+      bool left = i == LEFT_FRONT_CHANNEL || i == LEFT_BACK_CHANNEL;
+      correction = alongCorrection + (left ? steering : -steering);
+    }
+    else
+    {
+      double error = positions[i] + offsets[i] - motors[i].position(vex::rotationUnits::deg);
+      stats.maxMechanismError = fmax(stats.maxMechanismError, fabs(error));
+      correction = PLAYBACK_POSITION_GAIN * error;
+    }
+    motors[i].spin(vex::directionType::fwd, velocities[i] * rate + correction, vex::velocityUnits::dps);
+  }
+  return true;
+}
+
+/**
+ * @brief returns whether a channel is a drive motor DriveKinematics has found disconnected
+ * @details The drive channels are in the same order as DriveKinematics::Wheels.
+ * @param channel int index from the RouteChannels enum
+ * @date 10/18/2026
+ */
+bool RoutePlayer::isLostDriveMotor(int channel)
+{
+  return channel <= RIGHT_BACK_CHANNEL && driveKinematics.getGain(channel) == 0;
+}
+
+/**
+ * @brief ends playback and prints how closely the route was followed
+ * @date 10/18/2026
+ */
+void RoutePlayer::finish()
+{
+  playing = false;
+  printf("Route player: %d ticks, cross-track %.2f in rms %.2f in max, along-track %.2f in max, heading %.1f deg max, "
+         "mechanisms %.0f deg max, %.0f msec behind schedule\n",
+         stats.ticks, stats.rmsCrossTrack, stats.maxCrossTrack, stats.maxAlongTrack, stats.maxHeadingError, stats.maxMechanismError, stats.timeShift);
+}
+
+/**
+ * @brief stops playback and the route's motors where they are
+ * @date 10/18/2026
+ */
+void RoutePlayer::stop()
+{
+  if (playing)
+  {
+    finish();
+  }
+  for (int i = 0; i < (int)motors.size(); i++)
+  {
+    motors[i].stop();
+  }
+}
+
+/**
+ * @brief returns whether a route is playing
+ * @date 10/18/2026
+ */
+bool RoutePlayer::isPlaying()
+{
+  return playing;
+}
+
+/**
+ * @brief returns the milliseconds since playback started
+ * @date 10/18/2026
+ */
+double RoutePlayer::getTime()
+{
+  return playTimer.time(vex::timeUnits::msec);
+}
+
+/**
+ * @brief returns how closely the robot has followed the route playing or last played
+ * @date 10/18/2026
+ */
+RouteTrackingStats RoutePlayer::getStats()
+{
+  return stats;
+}
@@ -0,0 +1,313 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       route-recorder.cpp                                        */
+/*    Created:      10/18/2026                                                */
+/*    Description:  Double-buffered binary route recording to the SD card     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include "vex.h"
+#include "route-recorder.h"
+
+using namespace vex;
+
+// Route files are named route00.bin to route99.bin; start() takes the first unused one
+const int MAX_ROUTE_FILES = 100;
+// Milliseconds the writer task sleeps while neither buffer is ready
+const int ROUTE_WRITE_POLL = 5;
+
+/**
+ * @brief constructs an idle RouteRecorder
+ * @param newCard the Brain's SD card that routes are written to
+ * @param newClamp VEX V5 pneumatic solenoid whose state is recorded in each record's flags
+ * @param newSamplePeriod int milliseconds between sample() calls, stored in the file header
+ * @date 10/18/2026
+ */
+RouteRecorder::RouteRecorder(vex::brain::sdcard &newCard, vex::pneumatics &newClamp, int newSamplePeriod)
+    : card(newCard), clamp(newClamp)
+{
+  samplePeriod = newSamplePeriod;
+  for (int i = 0; i < 2; i++)
+  {
+    bufferCounts[i] = 0;
+    bufferFull[i] = false;
+  }
+  sampleBuffer = 0;
+  recording = false;
+  writing = false;
+  file = NULL;
+  fileName[0] = '\0';
+  recordCount = 0;
+  droppedRecords = 0;
+  eventCount = 0;
+  lastFlags = 0;
+}
+
+/**
+ * @brief adds the next motor channel, in RouteChannels order; motors past NUMBER_OF_ROUTE_CHANNELS are ignored
+ * @param motor VEX V5 motor whose position is recorded
+ * @date 10/18/2026
+ */
+void RouteRecorder::addMotor(vex::motor motor)
+{
+  if (motors.size() < NUMBER_OF_ROUTE_CHANNELS)
+  {
+    motors.push_back(motor);
+  }
+}
+
+/**
+ * @brief opens the next unused route file, writes its header and starts the background writer
+ * @details Opening the file happens here, once, so sample() never touches the card. Recording cannot start
+ * while the writer is still flushing the last route.
+ * @relates autonomousTracking()
+ * @returns bool false if there is no SD card, no free file name, the file will not open or the last route is still being written
+ * @date 10/18/2026
+ */
+bool RouteRecorder::start()
+{
+  if (recording || writing || !card.isInserted())
+  {
+    return false;
+  }
+
+  int fileNumber = 0;
+  do
+  {
+    sprintf(fileName, "route%02d.bin", fileNumber);
+    fileNumber++;
+  } while (card.exists(fileName) && fileNumber < MAX_ROUTE_FILES);
+  if (card.exists(fileName))
+  {
+    return false;
+  }
+  file = fopen(fileName, "wb");
+  if (file == NULL)
+  {
+    return false;
+  }
+
+  RouteHeader header;
+  for (int i = 0; i < 4; i++)
+  {
+    header.magic[i] = ROUTE_MAGIC[i];
+  }
+  header.version = ROUTE_VERSION;
+  header.recordSize = sizeof(RouteRecord);
+  header.samplePeriod = samplePeriod;
+  header.channels = motors.size();
+  fwrite(&header, sizeof(RouteHeader), 1, file);
+
+  for (int i = 0; i < 2; i++)
+  {
+    bufferCounts[i] = 0;
+    bufferFull[i] = false;
+  }
+  sampleBuffer = 0;
+  recordCount = 0;
+  droppedRecords = 0;
+  eventCount = 0;
+  lastFlags = getFlags();
+  recordTimer.clear();
+  recording = true;
+  writing = true;
+  vex::thread writerThread = vex::thread(writeTask, this);
+  printf("Route recorder: recording to %s\n", fileName);
+  return true;
+}
+
+/**
+ * @brief returns the flags describing the clamp as it is now
+ * @date 10/18/2026
+ */
+uint8_t RouteRecorder::getFlags()
+{
+  return clamp.value() ? ROUTE_CLAMP_EXTENDED : 0;
+}
+
+/**
+ * @brief appends one record of every channel's position and the clamp state to the buffer being filled
+ * @details This only reads cached device values and copies them into RAM, so it costs the same few
+ * microseconds whether or not the card is busy. A full buffer is handed to the writer by setting its flag,
+ * and sampling moves to the other buffer. If the writer has not emptied that one yet the record is dropped
+ * and counted rather than waiting on the card.
+ * @param flags uint8_t RouteRecord flags for the clamp state
+ * @date 10/18/2026
+ */
+void RouteRecorder::addRecord(uint8_t flags)
+{
+  if (bufferFull[sampleBuffer])
+  {
+    droppedRecords++;
+    return;
+  }
+
+  RouteRecord &record = buffers[sampleBuffer][bufferCounts[sampleBuffer]];
+  record.time = recordTimer.time(vex::timeUnits::msec);
+  for (int i = 0; i < NUMBER_OF_ROUTE_CHANNELS; i++)
+  {
+    record.positions[i] = i < (int)motors.size() ? motors[i].position(vex::rotationUnits::deg) : 0;
+  }
+  record.flags = flags;
+  for (int i = 0; i < 3; i++)
+  {
+    record.reserved[i] = 0;
+  }
+  lastFlags = flags;
+  recordCount++;
+
+  bufferCounts[sampleBuffer]++;
+  if (bufferCounts[sampleBuffer] == RECORDS_PER_BUFFER)
+  {
+    bufferFull[sampleBuffer] = true;
+    sampleBuffer = 1 - sampleBuffer;
+  }
+}
+
+/**
+ * @brief records every channel and the clamp on the sample grid
+ * @relates autonomousTracking()
+ * @date 10/18/2026
+ */
+void RouteRecorder::sample()
+{
+  if (recording)
+  {
+    addRecord(getFlags());
+  }
+}
+
+/**
+ * @brief records the clamp changing as a discrete event the moment it is seen, between samples
+ * @details Drive, arm, intake and clamp all share one timeline: every record holds every channel and the
+ * clamp state, stamped by the same timer. Sampling alone would place a clamp change up to a whole sample
+ * period late, so this is called far more often than sample() and adds an extra record, off the sample
+ * grid, as soon as the clamp differs from the last record. Playback fires the clamp when it reaches that
+ * record, at the same point in the drive's motion it happened in the recording.
+ * @relates autonomousTracking()
+ * @date 10/18/2026
+ */
+void RouteRecorder::poll()
+{
+  uint8_t flags = getFlags();
+  if (recording && flags != lastFlags)
+  {
+    addRecord(flags);
+    eventCount++;
+  }
+}
+
+/**
+ * @brief hands the partly filled buffer to the writer and ends the recording; the writer closes the file once it is flushed
+ * @relates autonomousTracking()
+ * @date 10/18/2026
+ */
+void RouteRecorder::stop()
+{
+  if (!recording)
+  {
+    return;
+  }
+  if (!bufferFull[sampleBuffer] && bufferCounts[sampleBuffer] > 0)
+  {
+    bufferFull[sampleBuffer] = true;
+  }
+  recording = false;
+  printf("Route recorder: %s holds %d records, %d clamp events, %d dropped\n", fileName, recordCount, eventCount, droppedRecords);
+}
+
+/**
+ * @brief thread entry point for writeBuffers()
+ * @param recorder RouteRecorder that started the thread
+ * @date 10/18/2026
+ */
+int RouteRecorder::writeTask(void *recorder)
+{
+  static_cast<RouteRecorder *>(recorder)->writeBuffers();
+  return 0;
+}
+
+/**
+ * @brief writes full buffers to the card in the order they were filled until the recording stops and both are empty
+ * @details The buffers are handed back and forth with one flag each and no lock: sample() only writes to a
+ * buffer whose flag is clear and only sets it, and this task only reads a buffer whose flag is set and only
+ * clears it, after resetting its count. Buffers fill alternately, so writing them alternately keeps the
+ * records in time order, and stop() flags the partly filled one last.
+ * @relates start()
+ * @date 10/18/2026
+ */
+void RouteRecorder::writeBuffers()
+{
+  int writeBuffer = 0;
+  while (recording || bufferFull[writeBuffer])
+  {
+    if (bufferFull[writeBuffer])
+    {
+      fwrite(buffers[writeBuffer], sizeof(RouteRecord), bufferCounts[writeBuffer], file);
+      bufferCounts[writeBuffer] = 0;
+      bufferFull[writeBuffer] = false;
+      writeBuffer = 1 - writeBuffer;
+    }
+    else
+    {
+      wait(ROUTE_WRITE_POLL, msec);
+    }
+  }
+  fclose(file);
+  file = NULL;
+  writing = false;
+}
+
+/**
+ * @brief returns whether samples are being recorded
+ * @date 10/18/2026
+ */
+bool RouteRecorder::isRecording()
+{
+  return recording;
+}
+
+/**
+ * @brief returns the milliseconds between samples
+ * @date 10/18/2026
+ */
+int RouteRecorder::getSamplePeriod()
+{
+  return samplePeriod;
+}
+
+/**
+ * @brief returns the records taken since start()
+ * @date 10/18/2026
+ */
+int RouteRecorder::getRecordCount()
+{
+  return recordCount;
+}
+
+/**
+ * @brief returns the records lost since start() because the card fell a whole buffer behind
+ * @date 10/18/2026
+ */
+int RouteRecorder::getDroppedRecords()
+{
+  return droppedRecords;
+}
+
+/**
+ * @brief returns the clamp events recorded off the sample grid since start()
+ * @date 10/18/2026
+ */
+int RouteRecorder::getEventCount()
+{
+  return eventCount;
+}
+
+/**
+ * @brief returns the name of the route file being or last written
+ * @date 10/18/2026
+ */
+const char *RouteRecorder::getFileName()
+{
+  return fileName;
+}
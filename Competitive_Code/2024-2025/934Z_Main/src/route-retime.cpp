@@ -0,0 +1,209 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       route-retime.cpp                                          */
+/*    Created:      10/18/2026                                                */
+/*    Description:  Time-optimal retiming of recorded routes; no VEX          */
+/*                  dependencies so the route compiler shares it              */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include <math.h>
+#include "route-retime.h"
+
+// Longest a stop kept for a flag change may last, long enough for the clamp to close before moving on
+const double RETIME_MAX_DWELL = 0.25;
+
+/**
+ * @brief constructs a RouteRetimer
+ * @param newSpeedScale double fraction of each channel's top speed the retimed route may use
+ * @param newMaxCurrent double amps each motor may draw
+ * @date 10/18/2026
+ */
+RouteRetimer::RouteRetimer(double newSpeedScale, double newMaxCurrent)
+{
+  speedScale = newSpeedScale;
+  maxCurrent = newMaxCurrent;
+  originalDuration = 0;
+  retimedDuration = 0;
+}
+
+/**
+ * @brief returns the fastest a segment's path speed may change at a given speed
+ * @details Every channel accelerates in proportion to the path speed, so the channel with the least
+ * acceleration for its share of the motion sets the limit. A channel's acceleration is capped by its
+ * maximum, by maxCurrent, and when speeding up by the current its back-EMF still leaves room for.
+ * @param segment Segment being crossed
+ * @param speed double path speed, 1 being the segment's top speed
+ * @param speedingUp bool true when the segment is accelerated across
+ * @returns double path speed per second
+ * @date 10/18/2026
+ */
+double RouteRetimer::getAcceleration(const Segment &segment, double speed, bool speedingUp)
+{
+  double acceleration = HUGE_VAL;
+  for (int i = 0; i < NUMBER_OF_ROUTE_CHANNELS; i++)
+  {
+    double direction = fabs(segment.directions[i]);
+    if (direction == 0)
+    {
+      continue;
+    }
+    double current = maxCurrent;
+    if (speedingUp)
+    {
+      double headroom = ROUTE_MAX_VOLTAGE * (1 - direction * speed / ROUTE_CHANNEL_MAX_VELOCITY[i]) / ROUTE_MOTOR_RESISTANCE;
+      current = fmin(current, fmax(headroom, 0));
+    }
+    double channelAcceleration = fmin(ROUTE_CHANNEL_MAX_ACCELERATION[i], ROUTE_CHANNEL_ACCELERATION_PER_AMP[i] * current);
+    acceleration = fmin(acceleration, channelAcceleration / direction);
+  }
+  return acceleration;
+}
+
+/**
+ * @brief returns the seconds a segment takes accelerating from its start speed, cruising if it can, and braking to its end speed
+ * @param segment Segment being crossed
+ * @param startSpeed double path speed entering the segment
+ * @param endSpeed double path speed leaving the segment
+ * @date 10/18/2026
+ */
+double RouteRetimer::getSegmentTime(const Segment &segment, double startSpeed, double endSpeed)
+{
+  if (segment.length == 0)
+  {
+    return segment.dwell;
+  }
+  double speedingUp = getAcceleration(segment, startSpeed, true);
+  double slowingDown = getAcceleration(segment, endSpeed, false);
+  if (speedingUp <= 0 || slowingDown <= 0)
+  {
+    return startSpeed + endSpeed > 0 ? 2 * segment.length / (startSpeed + endSpeed) : 0;
+  }
+
+  double peakSquared = (slowingDown * startSpeed * startSpeed + speedingUp * endSpeed * endSpeed + 2 * speedingUp * slowingDown * segment.length) / (speedingUp + slowingDown);
+  if (peakSquared <= 1)
+  {
+    double peak = sqrt(peakSquared);
+    return (peak - startSpeed) / speedingUp + (peak - endSpeed) / slowingDown;
+  }
+  double speedingUpLength = (1 - startSpeed * startSpeed) / (2 * speedingUp);
+  double slowingDownLength = (1 - endSpeed * endSpeed) / (2 * slowingDown);
+  return (1 - startSpeed) / speedingUp + (1 - endSpeed) / slowingDown + (segment.length - speedingUpLength - slowingDownLength);
+}
+
+/**
+ * @brief returns the route on the same path with the fastest timing the motors can follow
+ * @details The path is split into straight segments between records, each measured by how long it takes
+ * at top speed, so a path speed of 1 puts the segment's busiest channel at speedScale of its top speed.
+ * Records that do not move are dropped, unless the flags change there, which keeps a short stop for the
+ * clamp. Where two segments meet, the change of direction is a corner every channel has to turn within
+ * its acceleration over half of each segment, which caps the path speed there: the sharper the corner,
+ * the slower. A forward pass then accelerates from rest as hard as each segment allows without passing
+ * a corner's cap, and a backward pass brakes early enough for every cap and for the stop at the end.
+ * Each segment's new duration is its accelerate, cruise and brake time between the two passes' speeds.
+ * Retiming works best on a simplified route: 10 msec records are noisy enough to look like corners.
+ * @param records std::vector<RouteRecord> route in time order
+ * @date 10/18/2026
+ */
+std::vector<RouteRecord> RouteRetimer::retime(const std::vector<RouteRecord> &records)
+{
+  std::vector<RouteRecord> nodes;
+  std::vector<Segment> segments;
+  if (records.empty())
+  {
+    return nodes;
+  }
+  nodes.push_back(records[0]);
+  for (int i = 1; i < (int)records.size(); i++)
+  {
+    const RouteRecord &last = nodes.back();
+    Segment segment;
+    segment.length = 0;
+    segment.dwell = 0;
+    for (int j = 0; j < NUMBER_OF_ROUTE_CHANNELS; j++)
+    {
+      segment.length = fmax(segment.length, fabs(records[i].positions[j] - last.positions[j]) / (ROUTE_CHANNEL_MAX_VELOCITY[j] * speedScale));
+    }
+    for (int j = 0; j < NUMBER_OF_ROUTE_CHANNELS; j++)
+    {
+      segment.directions[j] = segment.length > 0 ? (records[i].positions[j] - last.positions[j]) / segment.length : 0;
+    }
+    if (segment.length == 0 && records[i].flags == last.flags)
+    {
+      continue;
+    }
+    if (segment.length == 0)
+    {
+      segment.dwell = fmin((records[i].time - last.time) / 1000.0, RETIME_MAX_DWELL);
+    }
+    nodes.push_back(records[i]);
+    segments.push_back(segment);
+  }
+
+  // Corner caps, with the route starting and ending at rest and every stop for a flag change at rest
+  int count = segments.size();
+  std::vector<double> speeds(count + 1, 0);
+  for (int i = 1; i < count; i++)
+  {
+    const Segment &before = segments[i - 1];
+    const Segment &after = segments[i];
+    if (before.length == 0 || after.length == 0)
+    {
+      continue;
+    }
+    double cap = 1;
+    for (int j = 0; j < NUMBER_OF_ROUTE_CHANNELS; j++)
+    {
+      double turn = fabs(after.directions[j] - before.directions[j]);
+      if (turn > 0)
+      {
+        double acceleration = fmin(ROUTE_CHANNEL_MAX_ACCELERATION[j], ROUTE_CHANNEL_ACCELERATION_PER_AMP[j] * maxCurrent);
+        cap = fmin(cap, sqrt(acceleration * (before.length + after.length) / (2 * turn)));
+      }
+    }
+    speeds[i] = cap;
+  }
+
+  // Forward pass speeds up as hard as each segment allows, backward pass brakes in time for what follows
+  for (int i = 0; i < count; i++)
+  {
+    double reachable = sqrt(speeds[i] * speeds[i] + 2 * getAcceleration(segments[i], speeds[i], true) * segments[i].length);
+    speeds[i + 1] = fmin(speeds[i + 1], reachable);
+  }
+  for (int i = count - 1; i >= 0; i--)
+  {
+    double reachable = sqrt(speeds[i + 1] * speeds[i + 1] + 2 * getAcceleration(segments[i], speeds[i + 1], false) * segments[i].length);
+    speeds[i] = fmin(speeds[i], reachable);
+  }
+
+  double time = 0;
+  uint32_t lastTime = nodes[0].time;
+  for (int i = 0; i < count; i++)
+  {
+    time += getSegmentTime(segments[i], speeds[i], speeds[i + 1]);
+    uint32_t newTime = records[0].time + (uint32_t)lround(time * 1000);
+    nodes[i + 1].time = newTime > lastTime ? newTime : lastTime + 1;
+    lastTime = nodes[i + 1].time;
+  }
+  originalDuration = (records.back().time - records.front().time) / 1000.0;
+  retimedDuration = (nodes.back().time - nodes.front().time) / 1000.0;
+  return nodes;
+}
+
+/**
+ * @brief returns the seconds the last route retimed took as recorded
+ * @date 10/18/2026
+ */
+double RouteRetimer::getOriginalDuration()
+{
+  return originalDuration;
+}
+
+/**
+ * @brief returns the seconds the last route retimed is predicted to take
+ * @date 10/18/2026
+ */
+double RouteRetimer::getRetimedDuration()
+{
+  return retimedDuration;
+}
@@ -0,0 +1,202 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       route-simplify.cpp                                        */
+/*    Created:      10/18/2026                                                */
+/*    Description:  Ramer-Douglas-Peucker simplification of recorded routes;  */
+/*                  no VEX dependencies so the route compiler shares it       */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include <math.h>
+#include "route-simplify.h"
+
+/**
+ * @brief constructs a RouteSimplifier with the largest errors a dropped record may leave
+ * @param newPositionTolerance double inches the robot may be off the recorded position
+ * @param newHeadingTolerance double degrees the robot may be off the recorded heading
+ * @param newMechanismTolerance double degrees an arm or intake motor may be off its recorded position
+ * @date 10/18/2026
+ */
+RouteSimplifier::RouteSimplifier(double newPositionTolerance, double newHeadingTolerance, double newMechanismTolerance)
+{
+  positionTolerance = newPositionTolerance;
+  headingTolerance = newHeadingTolerance;
+  mechanismTolerance = newMechanismTolerance;
+  originalPoints = 0;
+  simplifiedPoints = 0;
+  duration = 0;
+  maxError = 0;
+}
+
+/**
+ * @brief returns how far outside tolerance the worst record between two kept records is when playback rebuilds it
+ * @details Every channel is rebuilt at each record's own time exactly the way RoutePlayer fills in between
+ * records, by interpolateChannel() with tangents from the kept records either side, and the rebuilt drive
+ * channels are dead reckoned from the first kept record's pose. Each error is divided by its tolerance, so
+ * a result above 1 means a record between them is needed.
+ * @param records std::vector<RouteRecord> the whole route
+ * @param poses std::vector<RoutePose> the pose at each record
+ * @param kept std::vector<bool> which records are kept so far
+ * @param first int index of the kept record before
+ * @param last int index of the kept record after
+ * @param worst int set to the index of the record furthest outside tolerance, or -1 if there are none between
+ * @date 10/18/2026
+ */
+double RouteSimplifier::getWorstError(const std::vector<RouteRecord> &records, const std::vector<RoutePose> &poses, const std::vector<bool> &kept, int first, int last, int &worst)
+{
+  int before = first - 1;
+  while (before >= 0 && !kept[before])
+  {
+    before--;
+  }
+  if (before < 0)
+  {
+    before = first;
+  }
+  int after = last + 1;
+  while (after < (int)records.size() && !kept[after])
+  {
+    after++;
+  }
+  if (after >= (int)records.size())
+  {
+    after = last;
+  }
+
+  RouteOdometry odometry;
+  odometry.reset(records[first], poses[first]);
+  double worstError = 0;
+  worst = -1;
+  for (int i = first + 1; i < last; i++)
+  {
+    RouteRecord rebuilt = records[i];
+    for (int j = 0; j < NUMBER_OF_ROUTE_CHANNELS; j++)
+    {
+      double position;
+      double velocity;
+      interpolateChannel(records[before], records[first], records[last], records[after], j, records[i].time, position, velocity);
+      rebuilt.positions[j] = position;
+    }
+    RoutePose pose = odometry.update(rebuilt);
+    double error = fmax(hypot(poses[i].x - pose.x, poses[i].y - pose.y) / positionTolerance,
+                        fabs(poses[i].heading - pose.heading) / headingTolerance);
+    for (int j = LEFT_ARM_CHANNEL; j < NUMBER_OF_ROUTE_CHANNELS; j++)
+    {
+      error = fmax(error, fabs(records[i].positions[j] - rebuilt.positions[j]) / mechanismTolerance);
+    }
+    if (error > worstError)
+    {
+      worst = i;
+      worstError = error;
+    }
+  }
+  return worstError;
+}
+
+/**
+ * @brief returns the route with only the records needed to stay within tolerance
+ * @details Ramer-Douglas-Peucker: between two kept records, the record furthest outside tolerance is kept,
+ * and every pair of kept records is checked again until a whole pass keeps nothing more. The check is
+ * against the Catmull-Rom curve playback draws, whose tangents come from the kept records on either side,
+ * so keeping a record can change its neighbours' curves too; the final pass checks every record against
+ * the curves of the route as returned. The first and last records are always kept, and so are both records
+ * around every flag change, so the clamp still fires at its recorded moment. Record times are unchanged,
+ * so the route plays for exactly as long as it was recorded and only gets smaller.
+ * @param records std::vector<RouteRecord> route in time order
+ * @date 10/18/2026
+ */
+std::vector<RouteRecord> RouteSimplifier::simplify(const std::vector<RouteRecord> &records)
+{
+  int count = records.size();
+  std::vector<bool> kept(count, false);
+  std::vector<RoutePose> poses(count);
+  RouteOdometry odometry;
+  if (count > 0)
+  {
+    odometry.reset(records[0]);
+    kept[0] = true;
+    kept[count - 1] = true;
+  }
+  for (int i = 0; i < count; i++)
+  {
+    poses[i] = odometry.update(records[i]);
+    if (i > 0 && records[i].flags != records[i - 1].flags)
+    {
+      kept[i - 1] = true;
+      kept[i] = true;
+    }
+  }
+
+  bool keeping = true;
+  while (keeping)
+  {
+    keeping = false;
+    maxError = 0;
+    int first = 0;
+    for (int i = 1; i < count; i++)
+    {
+      if (!kept[i])
+      {
+        continue;
+      }
+      int worst;
+      double error = getWorstError(records, poses, kept, first, i, worst);
+      if (error > 1)
+      {
+        kept[worst] = true;
+        keeping = true;
+      }
+      maxError = fmax(maxError, error);
+      first = i;
+    }
+  }
+
+  std::vector<RouteRecord> simplified;
+  for (int i = 0; i < count; i++)
+  {
+    if (kept[i])
+    {
+      simplified.push_back(records[i]);
+    }
+  }
+  originalPoints = count;
+  simplifiedPoints = simplified.size();
+  duration = count > 0 ? (records[count - 1].time - records[0].time) / 1000.0 : 0;
+  return simplified;
+}
+
+/**
+ * @brief returns the records in the last route simplified
+ * @date 10/18/2026
+ */
+int RouteSimplifier::getOriginalPoints()
+{
+  return originalPoints;
+}
+
+/**
+ * @brief returns the records kept from the last route simplified
+ * @date 10/18/2026
+ */
+int RouteSimplifier::getSimplifiedPoints()
+{
+  return simplifiedPoints;
+}
+
+/**
+ * @brief returns the seconds the last route simplified plays for, the same before and after
+ * @date 10/18/2026
+ */
+double RouteSimplifier::getDuration()
+{
+  return duration;
+}
+
+/**
+ * @brief returns the largest error playback leaves at a dropped record of the last route simplified, as a fraction of its tolerance
+ * @date 10/18/2026
+ */
+double RouteSimplifier::getMaxError()
+{
+  return maxError;
+}
@@ -0,0 +1,281 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       route-sources.cpp                                         */
+/*    Created:      10/18/2026                                                */
+/*    Description:  Sources route playback can read records from              */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include "vex.h"
+#include "route-sources.h"
+
+using namespace vex;
+
+// Milliseconds the prefetch task sleeps while every chunk is waiting to be played, and playback waits on an underrun
+const int ROUTE_PREFETCH_POLL = 1;
+
+/**
+ * @brief constructs a closed RouteFileSource, allocating its chunks once so reading a route never allocates
+ * @date 10/18/2026
+ */
+RouteFileSource::RouteFileSource() : chunks(NUMBER_OF_CHUNKS * RECORDS_PER_CHUNK)
+{
+  for (int i = 0; i < NUMBER_OF_CHUNKS; i++)
+  {
+    chunkCounts[i] = 0;
+    chunkReady[i] = false;
+  }
+  readChunk = 0;
+  index = 0;
+  file = NULL;
+  prefetching = false;
+  closing = false;
+  underruns = 0;
+}
+
+/**
+ * @brief closes the route file, stopping the prefetch task first
+ * @date 10/18/2026
+ */
+RouteFileSource::~RouteFileSource()
+{
+  close();
+}
+
+/**
+ * @brief reads up to one chunk of records from the route file
+ * @param chunk int index of the chunk to fill
+ * @returns int records read, fewer than RECORDS_PER_CHUNK at the end of the file
+ * @date 10/18/2026
+ */
+int RouteFileSource::readChunkFromFile(int chunk)
+{
+  return fread(&chunks[chunk * RECORDS_PER_CHUNK], sizeof(RouteRecord), RECORDS_PER_CHUNK, file);
+}
+
+/**
+ * @brief opens a route file on the SD card positioned at its first record
+ * @details The header must carry ROUTE_MAGIC, ROUTE_VERSION and this build's record size, so a file from
+ * an older recorder is refused rather than misread.
+ * @param fileName const char* name of the route file on the SD card
+ * @returns FILE* open route file, or NULL if the file is missing or not a route of this version
+ * @date 10/18/2026
+ */
+FILE *RouteFileSource::openRoute(const char *fileName)
+{
+  FILE *routeFile = fopen(fileName, "rb");
+  if (routeFile == NULL)
+  {
+    printf("Route file %s not found\n", fileName);
+    return NULL;
+  }
+
+  RouteHeader header;
+  bool valid = fread(&header, sizeof(RouteHeader), 1, routeFile) == 1;
+  for (int i = 0; valid && i < 4; i++)
+  {
+    valid = header.magic[i] == ROUTE_MAGIC[i];
+  }
+  if (!valid || header.version != ROUTE_VERSION || header.recordSize != sizeof(RouteRecord))
+  {
+    printf("Route file %s is not a version %d route\n", fileName, ROUTE_VERSION);
+    fclose(routeFile);
+    return NULL;
+  }
+  return routeFile;
+}
+
+/**
+ * @brief reads a whole route file once to find its duration and checksum, without keeping any of it
+ * @details This reads every byte, so it belongs in route selection before the match, never in playback.
+ * The checksum covers the whole file, header included, and matches the file checksum the route compiler
+ * prints, so the selector can show which recording is on the card.
+ * @relates RouteLibrary::select()
+ * @param fileName const char* name of the route file on the SD card
+ * @param duration uint32_t set to the msec from the first record to the last
+ * @param checksum uint32_t set to the route checksum of the file
+ * @returns bool false if the file is missing, not a route of this version or empty
+ * @date 10/18/2026
+ */
+bool RouteFileSource::inspect(const char *fileName, uint32_t &duration, uint32_t &checksum)
+{
+  FILE *routeFile = openRoute(fileName);
+  if (routeFile == NULL)
+  {
+    return false;
+  }
+  RouteHeader header;
+  fseek(routeFile, 0, SEEK_SET);
+  fread(&header, sizeof(RouteHeader), 1, routeFile);
+  checksum = updateRouteChecksum(ROUTE_CHECKSUM_SEED, (const uint8_t *)&header, sizeof(RouteHeader));
+
+  RouteRecord record;
+  int count = 0;
+  uint32_t firstTime = 0;
+  while (fread(&record, sizeof(RouteRecord), 1, routeFile) == 1)
+  {
+    if (count == 0)
+    {
+      firstTime = record.time;
+    }
+    checksum = updateRouteChecksum(checksum, (const uint8_t *)&record, sizeof(RouteRecord));
+    count++;
+  }
+  fclose(routeFile);
+  duration = count > 0 ? record.time - firstTime : 0;
+  return count > 0;
+}
+
+/**
+ * @brief opens a route file on the SD card and reads its first chunk, leaving the rest to the prefetch task
+ * @details The header is checked as in openRoute(). Only it and the first RECORDS_PER_CHUNK records are
+ * read here, so the time from enable to first motion is the same for a 15 sec auton and a 60 sec skills
+ * route, and RAM use is NUMBER_OF_CHUNKS chunks whatever the route's length.
+ * @relates autonomous()
+ * @param fileName const char* name of the route file on the SD card
+ * @returns bool false if the file is missing, not a route of this version or empty
+ * @date 10/18/2026
+ */
+bool RouteFileSource::open(const char *fileName)
+{
+  close();
+  file = openRoute(fileName);
+  if (file == NULL)
+  {
+    return false;
+  }
+
+  chunkCounts[0] = readChunkFromFile(0);
+  chunkReady[0] = true;
+  if (chunkCounts[0] < RECORDS_PER_CHUNK)
+  {
+    fclose(file);
+    file = NULL;
+  }
+  else
+  {
+    prefetching = true;
+    vex::thread prefetchThread = vex::thread(prefetchTask, this);
+  }
+  printf("Route file %s: streaming\n", fileName);
+  return chunkCounts[0] > 0;
+}
+
+/**
+ * @brief thread entry point for prefetch()
+ * @param source RouteFileSource that started the thread
+ * @date 10/18/2026
+ */
+int RouteFileSource::prefetchTask(void *source)
+{
+  static_cast<RouteFileSource *>(source)->prefetch();
+  return 0;
+}
+
+/**
+ * @brief fills chunks from the card in ring order, each as soon as playback hands it back, until the file ends
+ * @details The chunks are handed back and forth with one flag each and no lock, the same way RouteRecorder
+ * hands its buffers to its writer: this task only fills a chunk whose flag is clear and only sets it, and
+ * next() only reads a chunk whose flag is set and only clears it once every record in it has been played.
+ * A chunk with fewer than RECORDS_PER_CHUNK records marks the end of the file.
+ * @relates open()
+ * @date 10/18/2026
+ */
+void RouteFileSource::prefetch()
+{
+  int chunk = 1 % NUMBER_OF_CHUNKS;
+  while (!closing)
+  {
+    if (chunkReady[chunk])
+    {
+      wait(ROUTE_PREFETCH_POLL, msec);
+      continue;
+    }
+    int count = readChunkFromFile(chunk);
+    chunkCounts[chunk] = count;
+    chunkReady[chunk] = true;
+    if (count < RECORDS_PER_CHUNK)
+    {
+      break;
+    }
+    chunk = (chunk + 1) % NUMBER_OF_CHUNKS;
+  }
+  fclose(file);
+  file = NULL;
+  prefetching = false;
+}
+
+/**
+ * @brief copies out the next record, moving to the next chunk once the current one has been played
+ * @details With NUMBER_OF_CHUNKS chunks of RECORDS_PER_CHUNK 10 msec records the prefetch task stays over a
+ * second ahead, so the next chunk is normally ready long before it is needed. If the card ever falls that
+ * far behind, playback waits for it and the wait is counted as an underrun rather than ending the route early.
+ * @param record RouteRecord set to the next record
+ * @returns bool false once every record has been read
+ * @date 10/18/2026
+ */
+bool RouteFileSource::next(RouteRecord &record)
+{
+  while (index >= chunkCounts[readChunk])
+  {
+    if (chunkCounts[readChunk] < RECORDS_PER_CHUNK)
+    {
+      return false;
+    }
+    chunkReady[readChunk] = false;
+    readChunk = (readChunk + 1) % NUMBER_OF_CHUNKS;
+    index = 0;
+    if (!chunkReady[readChunk])
+    {
+      underruns++;
+      while (!chunkReady[readChunk] && prefetching)
+      {
+        wait(ROUTE_PREFETCH_POLL, msec);
+      }
+      if (!chunkReady[readChunk])
+      {
+        chunkCounts[readChunk] = 0;
+        return false;
+      }
+    }
+  }
+  record = chunks[readChunk * RECORDS_PER_CHUNK + index];
+  index++;
+  return true;
+}
+
+/**
+ * @brief stops the prefetch task, closes the route file and empties every chunk
+ * @date 10/18/2026
+ */
+void RouteFileSource::close()
+{
+  closing = true;
+  while (prefetching)
+  {
+    wait(ROUTE_PREFETCH_POLL, msec);
+  }
+  if (file != NULL)
+  {
+    fclose(file);
+    file = NULL;
+  }
+  closing = false;
+  for (int i = 0; i < NUMBER_OF_CHUNKS; i++)
+  {
+    chunkCounts[i] = 0;
+    chunkReady[i] = false;
+  }
+  readChunk = 0;
+  index = 0;
+  underruns = 0;
+}
+
+/**
+ * @brief returns how many times playback had to wait for the card since the route was opened
+ * @date 10/18/2026
+ */
+int RouteFileSource::getUnderruns()
+{
+  return underruns;
+}
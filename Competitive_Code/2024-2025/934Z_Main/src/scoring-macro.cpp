@@ -0,0 +1,223 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       scoring-macro.cpp                                         */
+/*    Created:      10/18/2026                                                */
+/*    Description:  One-button intake-to-arm scoring sequence                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include "vex.h"
+#include "scoring-macro.h"
+
+using namespace vex;
+
+// Arm position in degrees where the intake hands a ring to the arm - tune on robot
+const double ARM_LOAD_POSITION = 90;
+// Arm position in degrees where the arm scores, matches the ButtonUp preset
+const double ARM_SCORE_POSITION = 720;
+// Degrees from an arm target at which the arm is considered there
+const double ARM_TOLERANCE = 10;
+// Intake degrees that carry a ring from the intake onto the arm - tune on robot
+const double LOAD_INTAKE_DEGREES = 600;
+// Milliseconds any one stage may take before the macro gives up
+const double STAGE_TIMEOUT = 2000;
+
+// Stage names used when logging stage times
+const char *STAGE_NAMES[] = {"IDLE", "SECURE_GOAL", "LOAD_ARM", "RAISE_ARM", "LOWER_ARM"};
+
+/**
+ * @brief constructs a ScoringMacro around the mechanisms it sequences
+ * @param newIntakeMotors VEX motor_group of the intake motors, read for handoff progress
+ * @param newArmMotors VEX motor_group of the arm motors, driven by the macro
+ * @param newAutoClamp AutoClamp that holds the mobile goal
+ * @param newGoalDetected function returning true while a goal is at the clamp
+ * @date 10/18/2026
+ */
+ScoringMacro::ScoringMacro(vex::motor_group &newIntakeMotors, vex::motor_group &newArmMotors, AutoClamp &newAutoClamp, bool (*newGoalDetected)())
+    : intakeMotors(newIntakeMotors), armMotors(newArmMotors), autoClamp(newAutoClamp), goalDetected(newGoalDetected)
+{
+  stage = IDLE;
+  intakeVelocity = 0;
+  stageStartIntakePosition = 0;
+  for (int i = 0; i < NUMBER_OF_STAGES; i++)
+  {
+    stageTimes[i] = 0;
+  }
+}
+
+/**
+ * @brief records the time spent in the current stage and starts newStage
+ * @param newStage MacroStages stage to enter
+ * @date 10/18/2026
+ */
+void ScoringMacro::enterStage(MacroStages newStage)
+{
+  stageTimes[stage] = stageTimer.time(vex::timeUnits::msec);
+  stage = newStage;
+  stageTimer.clear();
+  stageStartIntakePosition = intakeMotors.position(vex::rotationUnits::deg);
+
+  switch (stage)
+  {
+  case (SECURE_GOAL):
+    intakeVelocity = 0;
+    if (goalDetected() && !autoClamp.isClamped())
+    {
+      autoClamp.setClamped(true);
+    }
+    break;
+  case (LOAD_ARM):
+    intakeVelocity = 100;
+    armMotors.spinToPosition(ARM_LOAD_POSITION, vex::rotationUnits::deg, false);
+    break;
+  case (RAISE_ARM):
+    intakeVelocity = 0;
+    armMotors.spinToPosition(ARM_SCORE_POSITION, vex::rotationUnits::deg, false);
+    break;
+  case (LOWER_ARM):
+    intakeVelocity = 0;
+    armMotors.spinToPosition(0, vex::rotationUnits::deg, false);
+    break;
+  default:
+    intakeVelocity = 0;
+    break;
+  }
+}
+
+/**
+ * @brief prints the time each stage took and returns the macro to IDLE
+ * @param result const char* reason the macro ended, printed with the stage times
+ * @date 10/18/2026
+ */
+void ScoringMacro::finish(const char *result)
+{
+  stageTimes[stage] = stageTimer.time(vex::timeUnits::msec);
+  double totalTime = 0;
+  int slowestStage = SECURE_GOAL;
+  printf("Scoring macro %s:", result);
+  for (int i = SECURE_GOAL; i <= stage; i++)
+  {
+    printf(" %s %.0f msec", STAGE_NAMES[i], stageTimes[i]);
+    totalTime += stageTimes[i];
+    if (stageTimes[i] > stageTimes[slowestStage])
+    {
+      slowestStage = i;
+    }
+  }
+  printf(", total %.0f msec, slowest %s\n", totalTime, STAGE_NAMES[slowestStage]);
+
+  stage = IDLE;
+  intakeVelocity = 0;
+  armMotors.stop();
+}
+
+/**
+ * @brief starts the scoring sequence from the beginning
+ * @relates usercontrol()
+ * @date 10/18/2026
+ */
+void ScoringMacro::start()
+{
+  for (int i = 0; i < NUMBER_OF_STAGES; i++)
+  {
+    stageTimes[i] = 0;
+  }
+  stage = IDLE;
+  stageTimer.clear();
+  enterStage(SECURE_GOAL);
+}
+
+/**
+ * @brief stops the scoring sequence where it is and hands control back to the driver
+ * @relates usercontrol()
+ * @date 10/18/2026
+ */
+void ScoringMacro::cancel()
+{
+  if (stage != IDLE)
+  {
+    finish("cancelled");
+  }
+}
+
+/**
+ * @brief advances the scoring sequence by one control tick
+ * @details Each stage ends on a sensor or position condition rather than a fixed delay:
+ * SECURE_GOAL once the goal is clamped or no goal is present, LOAD_ARM once the arm is at its load
+ * position and the intake has carried a ring LOAD_INTAKE_DEGREES onto it, RAISE_ARM and LOWER_ARM once
+ * the arm is within ARM_TOLERANCE of its target. A stage that runs past STAGE_TIMEOUT ends the macro.
+ * @relates usercontrol()
+ * @date 10/18/2026
+ */
+void ScoringMacro::update()
+{
+  if (stage == IDLE)
+  {
+    return;
+  }
+
+  if (stageTimer.time(vex::timeUnits::msec) > STAGE_TIMEOUT)
+  {
+    finish("timed out");
+    return;
+  }
+
+  double armPosition = armMotors.position(vex::rotationUnits::deg);
+  switch (stage)
+  {
+  case (SECURE_GOAL):
+    if (autoClamp.isClamped() || !goalDetected())
+    {
+      enterStage(LOAD_ARM);
+    }
+    break;
+  case (LOAD_ARM):
+    if (fabs(armPosition - ARM_LOAD_POSITION) < ARM_TOLERANCE && intakeMotors.position(vex::rotationUnits::deg) - stageStartIntakePosition >= LOAD_INTAKE_DEGREES)
+    {
+      enterStage(RAISE_ARM);
+    }
+    break;
+  case (RAISE_ARM):
+    if (fabs(armPosition - ARM_SCORE_POSITION) < ARM_TOLERANCE)
+    {
+      enterStage(LOWER_ARM);
+    }
+    break;
+  case (LOWER_ARM):
+    if (fabs(armPosition) < ARM_TOLERANCE)
+    {
+      finish("finished");
+    }
+    break;
+  default:
+    break;
+  }
+}
+
+/**
+ * @brief returns whether the scoring sequence is running
+ * @date 10/18/2026
+ */
+bool ScoringMacro::isRunning()
+{
+  return stage != IDLE;
+}
+
+/**
+ * @brief returns the percent intake velocity the current stage needs
+ * @details The intake is driven through the intake JamDetectors so jams are still cleared during the macro.
+ * @date 10/18/2026
+ */
+double ScoringMacro::getIntakeVelocity()
+{
+  return intakeVelocity;
+}
+
+/**
+ * @brief returns the current stage of the scoring sequence
+ * @date 10/18/2026
+ */
+ScoringMacro::MacroStages ScoringMacro::getStage()
+{
+  return stage;
+}
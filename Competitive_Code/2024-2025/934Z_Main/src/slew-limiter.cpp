@@ -0,0 +1,84 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       slew-limiter.cpp                                          */
+/*    Created:      10/18/2026                                                */
+/*    Description:  Per-side slew rate limiting for driver control            */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include "vex.h"
+#include "slew-limiter.h"
+
+using namespace vex;
+
+/**
+ * @brief constructs a SlewRateLimiter that starts at rest with no limits
+ * @date 10/18/2026
+ */
+SlewRateLimiter::SlewRateLimiter()
+{
+  output = 0;
+  accelerationLimit = 200;
+  decelerationLimit = 200;
+}
+
+/**
+ * @brief sets the largest change in command allowed per tick
+ * @details Acceleration is any change that moves the command away from zero; deceleration is any
+ * change toward zero. Keeping deceleration looser than acceleration lets the robot stop quickly
+ * while launches stay below the point where the wheels break traction.
+ * @relates usercontrol()
+ * @param newAccelerationLimit double percent per tick the command may grow in magnitude
+ * @param newDecelerationLimit double percent per tick the command may shrink in magnitude
+ * @date 10/18/2026
+ */
+void SlewRateLimiter::setLimits(double newAccelerationLimit, double newDecelerationLimit)
+{
+  accelerationLimit = newAccelerationLimit;
+  decelerationLimit = newDecelerationLimit;
+}
+
+/**
+ * @brief moves the limited command one tick toward target and returns it
+ * @details A full-stick reversal first decelerates to zero at the deceleration limit, then
+ * accelerates the other way at the acceleration limit.
+ * @relates usercontrol()
+ * @param target double percent command requested by the driver
+ * @returns double percent command to send to the motors this tick
+ * @date 10/18/2026
+ */
+double SlewRateLimiter::update(double target)
+{
+  double change = target - output;
+  bool towardZero = (output > 0 && change < 0) || (output < 0 && change > 0);
+  double limit = towardZero ? decelerationLimit : accelerationLimit;
+
+  // Deceleration may only carry the command to zero in one step; the rest is acceleration
+  if (towardZero && fabs(change) > fabs(output))
+  {
+    double decelerationStep = fmin(fabs(output), decelerationLimit);
+    output += output > 0 ? -decelerationStep : decelerationStep;
+    return output;
+  }
+
+  if (change > limit)
+  {
+    change = limit;
+  }
+  else if (change < -limit)
+  {
+    change = -limit;
+  }
+  output += change;
+  return output;
+}
+
+/**
+ * @brief sets the limited command directly, e.g. when driver control starts
+ * @param newOutput double percent command to continue from
+ * @date 10/18/2026
+ */
+void SlewRateLimiter::reset(double newOutput)
+{
+  output = newOutput;
+}
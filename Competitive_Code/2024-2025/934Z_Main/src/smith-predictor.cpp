@@ -0,0 +1,201 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       smith-predictor.cpp                                       */
+/*    Created:      10/18/2026                                                */
+/*    Description:  Dead time estimation and Smith predictor for control loops*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include "vex.h"
+#include "smith-predictor.h"
+
+using namespace vex;
+
+// Ticks of dead time assumed until one is measured; a command takes effect a tick after it is sent
+const double DEFAULT_DELAY_TICKS = 1;
+// Fraction each measured dead time moves the estimate by, averaging out single late readings
+const double DELAY_FILTER = 0.2;
+// Command change, in command units, large enough to time the response to
+const double STEP_THRESHOLD = 20;
+// Command change per tick, in command units, small enough to count as holding steady
+const double STEADY_CHANGE = 1;
+// Ticks after a step with no response before the step is abandoned as unmeasurable
+const int STEP_TIMEOUT_TICKS = 3 * SmithPredictor::MAX_DELAY_TICKS;
+// Seconds per control tick assumed before the first two readings have been timed
+const double DEFAULT_TICK_TIME = 0.02;
+
+/**
+ * @brief constructs a SmithPredictor around a first-order model of the controlled state
+ * @param newModelGain double steady state reached per unit of command (1 for percent velocity from percent command)
+ * @param newTimeConstant double seconds the state takes to reach 63% of a step with no dead time
+ * @param newResponseThreshold double change in the state, in its own units, that marks a response to a step
+ * @date 10/18/2026
+ */
+SmithPredictor::SmithPredictor(double newModelGain, double newTimeConstant, double newResponseThreshold)
+{
+  modelGain = newModelGain;
+  timeConstant = newTimeConstant;
+  responseThreshold = newResponseThreshold;
+  delayTicks = DEFAULT_DELAY_TICKS;
+  tickTime = DEFAULT_TICK_TIME;
+  reset(0);
+}
+
+/**
+ * @brief restarts the model and prediction at a known state, keeping the dead time estimate
+ * @param measurement double current state of the plant
+ * @date 10/18/2026
+ */
+void SmithPredictor::reset(double measurement)
+{
+  for (int i = 0; i <= MAX_DELAY_TICKS; i++)
+  {
+    modelHistory[i] = measurement;
+    measurementHistory[i] = measurement;
+  }
+  historyIndex = 0;
+  model = measurement;
+  command = measurement / modelGain;
+  lastMeasurement = measurement;
+  prediction = measurement;
+  tick = 0;
+  lastTime = -1;
+  timingStep = false;
+  steadyTick = 0;
+  steadyCommand = command;
+  rampTimed = false;
+}
+
+/**
+ * @brief takes this tick's delayed reading and returns the state the plant is actually in now
+ * @details The model is run forward with the commands sent, undelayed, and its output is kept for
+ * MAX_DELAY_TICKS. The reading lags reality by the dead time, so the prediction is the reading plus what the
+ * model says the commands still in flight will have done by now: reading + model(now) - model(now - delay).
+ * A model that is wrong only in the part of its response already seen cancels out, so the controller sees
+ * the real plant without its dead time and can run the gains the delay-free plant allows.
+ *
+ * The dead time is measured from the loop's own commands: after a step in command the ticks until the
+ * reading responds, less the ticks the undelayed model took to respond the same amount, is one sample.
+ * Must be called once per control tick before the controller computes its command.
+ * @param measurement double latest reading of the state
+ * @returns double predicted current state
+ * @date 10/18/2026
+ */
+double SmithPredictor::predict(double measurement)
+{
+  double now = predictorTimer.time(vex::timeUnits::msec) / 1000.0;
+  if (lastTime >= 0 && now > lastTime)
+  {
+    tickTime += (now - lastTime - tickTime) * DELAY_FILTER;
+  }
+  lastTime = now;
+
+  model += (modelGain * command - model) * fmin(tickTime / timeConstant, 1);
+  historyIndex = (historyIndex + 1) % (MAX_DELAY_TICKS + 1);
+  modelHistory[historyIndex] = model;
+  measurementHistory[historyIndex] = measurement;
+  tick++;
+
+  if (timingStep)
+  {
+    checkStepResponse(tick - stepTick, model, measurement);
+  }
+
+  int delay = (int)(delayTicks + 0.5);
+  double delayedModel = modelHistory[(historyIndex - delay + MAX_DELAY_TICKS + 1) % (MAX_DELAY_TICKS + 1)];
+  prediction = measurement + model - delayedModel;
+  lastMeasurement = measurement;
+  return prediction;
+}
+
+/**
+ * @brief advances a step being timed by one tick of model and reading
+ * @details The model's response is noted first; once the reading responds as much, the ticks between the two
+ * are one dead time sample. A step that never gets a response within STEP_TIMEOUT_TICKS is abandoned.
+ * @param elapsed int ticks since the step started
+ * @param modelValue double model output at that tick
+ * @param measurement double reading at that tick
+ * @returns bool true once the step is finished with
+ * @date 10/18/2026
+ */
+bool SmithPredictor::checkStepResponse(int elapsed, double modelValue, double measurement)
+{
+  if (modelResponseTick < 0 && (modelValue - stepModel) * stepDirection >= responseThreshold)
+  {
+    modelResponseTick = elapsed;
+  }
+  if ((measurement - stepMeasurement) * stepDirection >= responseThreshold)
+  {
+    if (modelResponseTick >= 0)
+    {
+      double sample = fmin(fmax(elapsed - modelResponseTick, 0), MAX_DELAY_TICKS);
+      delayTicks += (sample - delayTicks) * DELAY_FILTER;
+    }
+    timingStep = false;
+  }
+  else if (elapsed > STEP_TIMEOUT_TICKS)
+  {
+    timingStep = false;
+  }
+  return !timingStep;
+}
+
+/**
+ * @brief records the command the controller is about to send, for the model and dead time measurement
+ * @details The drive's commands are slew limited, so a stick step arrives as a ramp as slow as 2.5 percent
+ * a tick rather than as one jump. A step is therefore a ramp that has moved STEP_THRESHOLD from the last
+ * tick the command held steady, within MAX_DELAY_TICKS ticks. It is timed from that steady tick, with the
+ * model and reading kept from it as the baseline, and the ticks of the ramp so far are replayed from the
+ * history so a response that began during the ramp is not missed. Each ramp is timed once: a new step
+ * cannot start until the command has held steady again.
+ * @param newCommand double command sent to the plant this tick
+ * @date 10/18/2026
+ */
+void SmithPredictor::setCommand(double newCommand)
+{
+  int rampTicks = tick - steadyTick;
+  if (fabs(newCommand - command) < STEADY_CHANGE)
+  {
+    steadyTick = tick;
+    steadyCommand = newCommand;
+    rampTimed = false;
+  }
+  else if (!timingStep && !rampTimed && rampTicks <= MAX_DELAY_TICKS && fabs(newCommand - steadyCommand) >= STEP_THRESHOLD)
+  {
+    int steadyIndex = (historyIndex - rampTicks + MAX_DELAY_TICKS + 1) % (MAX_DELAY_TICKS + 1);
+    timingStep = true;
+    rampTimed = true;
+    stepTick = steadyTick;
+    stepDirection = newCommand > steadyCommand ? 1 : -1;
+    stepMeasurement = measurementHistory[steadyIndex];
+    stepModel = modelHistory[steadyIndex];
+    modelResponseTick = -1;
+    for (int i = 1; i <= rampTicks; i++)
+    {
+      int index = (steadyIndex + i) % (MAX_DELAY_TICKS + 1);
+      if (checkStepResponse(i, modelHistory[index], measurementHistory[index]))
+      {
+        break;
+      }
+    }
+  }
+  command = newCommand;
+}
+
+/**
+ * @brief returns the last predicted current state
+ * @date 10/18/2026
+ */
+double SmithPredictor::getPrediction()
+{
+  return prediction;
+}
+
+/**
+ * @brief returns the estimated end-to-end sensor and actuator dead time in msec
+ * @date 10/18/2026
+ */
+double SmithPredictor::getDelay()
+{
+  return delayTicks * tickTime * 1000;
+}
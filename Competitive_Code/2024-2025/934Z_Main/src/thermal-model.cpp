@@ -0,0 +1,228 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       thermal-model.cpp                                         */
+/*    Created:      10/18/2026                                                */
+/*    Description:  Per-motor thermal prediction and smooth current derating  */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include "vex.h"
+#include "thermal-model.h"
+
+using namespace vex;
+
+// Degrees C per second a motor heats per amp squared drawn; an initial guess, not fitted, so derating
+// is untrusted until this is replaced with the heating rate printCalibration() prints over several runs
+const double HEATING_RATE = 0.032;
+// Fraction per second of a motor's rise above ambient that it sheds; also an initial guess, replace it
+// with the cooling rate printCalibration() prints
+const double COOLING_RATE = 1.0 / 300.0;
+// Fraction per second the model is pulled toward the motor's own coarse temperature reading
+const double OBSERVER_GAIN = 0.02;
+// Seconds of current history averaged to estimate the load the motor will keep seeing
+const double CURRENT_AVERAGE_TIME = 10;
+// Predicted degrees C at which derating begins
+const double DERATE_START_TEMPERATURE = 45;
+// Degrees C at which the motor firmware starts cutting power on its own
+const double FIRMWARE_LIMIT_TEMPERATURE = 55;
+// Fraction of full current left to a motor predicted to reach FIRMWARE_LIMIT_TEMPERATURE
+const double MIN_DERATING = 0.4;
+// Fraction per second the derating may change by, so output fades instead of stepping
+const double DERATING_SLEW = 0.1;
+// Seconds between calibration samples; the motor's temperature reading is too coarse for shorter spans
+const double CALIBRATION_INTERVAL = 10;
+
+/**
+ * @brief constructs a ThermalModel with no motors
+ * @param newHorizon double seconds ahead temperature is predicted (30 to 60 suits a match)
+ * @date 10/18/2026
+ */
+ThermalModel::ThermalModel(double newHorizon)
+{
+  horizon = newHorizon;
+  logging = false;
+  lastUpdateTime = 0;
+}
+
+/**
+ * @brief adds a motor to be modelled
+ * @relates pre_auton()
+ * @param newMotor VEX V5 motor to model
+ * @param name std::string name used when logging and printing calibration
+ * @date 10/18/2026
+ */
+void ThermalModel::addMotor(vex::motor newMotor, std::string name)
+{
+  MotorState newState = {newMotor, name, false, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+  motors.push_back(newState);
+}
+
+/**
+ * @brief advances every motor's thermal model and recomputes its derating
+ * @details Each motor is modelled as one lump that heats at HEATING_RATE * current^2 and cools toward the
+ * temperature it started at by COOLING_RATE * rise. The model is pulled gently toward the motor's reading
+ * so it stays honest without inheriting the reading's coarse steps. The temperature horizon seconds ahead
+ * is then predicted assuming the recent average load continues, which for this model is the exact
+ * exponential approach to that load's steady state. Predictions between DERATE_START_TEMPERATURE and
+ * FIRMWARE_LIMIT_TEMPERATURE fade the derating linearly down to MIN_DERATING.
+ * @relates currentBudgetTracking()
+ * @date 10/18/2026
+ */
+void ThermalModel::update()
+{
+  double now = thermalTimer.time(vex::timeUnits::sec);
+  double elapsed = now - lastUpdateTime;
+  lastUpdateTime = now;
+
+  for (int i = 0; i < motors.size(); i++)
+  {
+    MotorState &state = motors[i];
+    if (!state.thermalMotor.installed())
+    {
+      continue;
+    }
+    double measuredTemperature = state.thermalMotor.temperature(vex::temperatureUnits::celsius);
+    double current = state.thermalMotor.current(vex::currentUnits::amp);
+    if (!state.started)
+    {
+      state.started = true;
+      state.ambientTemperature = measuredTemperature;
+      state.modelTemperature = measuredTemperature;
+      state.sampleStartTime = now;
+      state.sampleStartTemperature = measuredTemperature;
+      continue;
+    }
+
+    double rise = state.modelTemperature - state.ambientTemperature;
+    state.modelTemperature += (HEATING_RATE * current * current - COOLING_RATE * rise) * elapsed;
+    state.modelTemperature += OBSERVER_GAIN * (measuredTemperature - state.modelTemperature) * elapsed;
+    state.averageCurrentSquared += (current * current - state.averageCurrentSquared) * fmin(elapsed / CURRENT_AVERAGE_TIME, 1);
+
+    double steadyTemperature = state.ambientTemperature + HEATING_RATE / COOLING_RATE * state.averageCurrentSquared;
+    state.predictedTemperature = steadyTemperature + (state.modelTemperature - steadyTemperature) * exp(-COOLING_RATE * horizon);
+
+    double targetDerating = 1 - (1 - MIN_DERATING) * (state.predictedTemperature - DERATE_START_TEMPERATURE) / (FIRMWARE_LIMIT_TEMPERATURE - DERATE_START_TEMPERATURE);
+    targetDerating = fmin(fmax(targetDerating, MIN_DERATING), 1);
+    double maxStep = DERATING_SLEW * elapsed;
+    state.derating += fmin(fmax(targetDerating - state.derating, -maxStep), maxStep);
+
+    state.sampleCurrentSquared += current * current;
+    state.sampleRise += measuredTemperature - state.ambientTemperature;
+    state.sampleTicks++;
+    if (now - state.sampleStartTime >= CALIBRATION_INTERVAL)
+    {
+      addCalibrationSample(state, measuredTemperature, now);
+    }
+  }
+}
+
+/**
+ * @brief closes one calibration sample and adds it to the motor's least squares fit
+ * @details Over each CALIBRATION_INTERVAL the measured heating slope is related to the mean current^2 and
+ * the mean rise above ambient, slope = HEATING_RATE * current^2 - COOLING_RATE * rise. The running sums
+ * let printCalibration() solve for both rates, and with logging on each sample is printed as CSV so
+ * several runs can be fitted together off the robot.
+ * @param state MotorState of the motor being sampled
+ * @param measuredTemperature double temperature read this tick in degrees C
+ * @param now double seconds since the model started
+ * @date 10/18/2026
+ */
+void ThermalModel::addCalibrationSample(MotorState &state, double measuredTemperature, double now)
+{
+  double slope = (measuredTemperature - state.sampleStartTemperature) / (now - state.sampleStartTime);
+  double currentSquared = state.sampleCurrentSquared / state.sampleTicks;
+  double rise = state.sampleRise / state.sampleTicks;
+
+  state.fitCurrentCurrent += currentSquared * currentSquared;
+  state.fitCurrentRise += currentSquared * rise;
+  state.fitRiseRise += rise * rise;
+  state.fitCurrentSlope += currentSquared * slope;
+  state.fitRiseSlope += rise * slope;
+  state.fitSamples++;
+
+  if (logging)
+  {
+    printf("thermal,%s,%.1f,%.3f,%.2f,%.4f,%.1f\n", state.name.c_str(), now, currentSquared, rise, slope, state.predictedTemperature);
+  }
+
+  state.sampleStartTime = now;
+  state.sampleStartTemperature = measuredTemperature;
+  state.sampleCurrentSquared = 0;
+  state.sampleRise = 0;
+  state.sampleTicks = 0;
+}
+
+/**
+ * @brief finds the model for a motor by its smart port
+ * @param motorToCheck VEX V5 motor to look up
+ * @returns MotorState pointer, or NULL if the motor was never added
+ * @date 10/18/2026
+ */
+ThermalModel::MotorState *ThermalModel::findMotor(vex::motor &motorToCheck)
+{
+  for (int i = 0; i < motors.size(); i++)
+  {
+    if (motors[i].thermalMotor.index() == motorToCheck.index())
+    {
+      return &motors[i];
+    }
+  }
+  return NULL;
+}
+
+/**
+ * @brief returns the fraction of full current the motor should be allowed, 1 while it is predicted to stay cool
+ * @param motorToCheck VEX V5 motor to look up
+ * @date 10/18/2026
+ */
+double ThermalModel::getDerating(vex::motor &motorToCheck)
+{
+  MotorState *state = findMotor(motorToCheck);
+  return state == NULL ? 1 : state->derating;
+}
+
+/**
+ * @brief returns the motor's temperature in degrees C predicted horizon seconds ahead
+ * @param motorToCheck VEX V5 motor to look up
+ * @date 10/18/2026
+ */
+double ThermalModel::getPredictedTemperature(vex::motor &motorToCheck)
+{
+  MotorState *state = findMotor(motorToCheck);
+  return state == NULL ? 0 : state->predictedTemperature;
+}
+
+/**
+ * @brief turns CSV logging of calibration samples over USB on or off
+ * @details Each line is thermal,name,seconds,current^2,rise,slope,predicted.
+ * @param newLogging bool whether calibration samples are printed
+ * @date 10/18/2026
+ */
+void ThermalModel::setLogging(bool newLogging)
+{
+  logging = newLogging;
+}
+
+/**
+ * @brief prints each motor's heating and cooling rates fitted from the samples logged so far
+ * @details Motors that have not been loaded and rested enough to separate the two rates are skipped.
+ * The fitted rates are meant to be checked across several runs before HEATING_RATE and COOLING_RATE
+ * are updated.
+ * @date 10/18/2026
+ */
+void ThermalModel::printCalibration()
+{
+  for (int i = 0; i < motors.size(); i++)
+  {
+    MotorState &state = motors[i];
+    double determinant = state.fitCurrentCurrent * state.fitRiseRise - state.fitCurrentRise * state.fitCurrentRise;
+    if (state.fitSamples < 3 || fabs(determinant) < 1e-9)
+    {
+      printf("Thermal %s: not enough varied samples (%d)\n", state.name.c_str(), state.fitSamples);
+      continue;
+    }
+    double heatingRate = (state.fitCurrentSlope * state.fitRiseRise - state.fitCurrentRise * state.fitRiseSlope) / determinant;
+    double coolingRate = (state.fitCurrentRise * state.fitCurrentSlope - state.fitCurrentCurrent * state.fitRiseSlope) / determinant;
+    printf("Thermal %s: heating %.4f C/A^2/s, cooling 1/%.0f s over %d samples (model %.4f, 1/%.0f)\n", state.name.c_str(), heatingRate, coolingRate > 0 ? 1 / coolingRate : 0, state.fitSamples, HEATING_RATE, 1 / COOLING_RATE);
+  }
+}
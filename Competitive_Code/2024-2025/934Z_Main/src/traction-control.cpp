@@ -0,0 +1,193 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       traction-control.cpp                                      */
+/*    Created:      10/18/2026                                                */
+/*    Description:  Wheel slip detection and traction control for the drive   */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include "vex.h"
+#include "traction-control.h"
+
+using namespace vex;
+
+// Percent difference between same-side wheel velocities that means one wheel is slipping
+const double SLIP_VELOCITY_SPLIT = 15;
+// Percent per tick a wheel may gain beyond what a gripping drive could before it is considered to be spinning free
+const double SLIP_ACCELERATION_MARGIN = 8;
+// Percent above the ground speed a slipping side is allowed to command, enough to keep accelerating
+const double TRACTION_MARGIN = 10;
+
+/**
+ * @brief constructs TractionControl for the four drive motors
+ * @param newTimeConstant double seconds a gripping drive side takes to reach 63% of a step in command
+ * @param newTickTime double seconds between apply() calls
+ * @date 10/18/2026
+ */
+TractionControl::TractionControl(vex::motor newLeftFront, vex::motor newLeftBack, vex::motor newRightFront, vex::motor newRightBack, double newTimeConstant, double newTickTime)
+    : leftFront(newLeftFront), leftBack(newLeftBack), rightFront(newRightFront), rightBack(newRightBack)
+{
+  response = 1 - exp(-newTickTime / newTimeConstant);
+  leftSlipping = false;
+  rightSlipping = false;
+  lastLeftVelocity = 0;
+  lastRightVelocity = 0;
+  lastLeftCommand = 0;
+  lastRightCommand = 0;
+  leftPosition = 0;
+  rightPosition = 0;
+  lastLeftFrontPosition = 0;
+  lastLeftBackPosition = 0;
+  lastRightFrontPosition = 0;
+  lastRightBackPosition = 0;
+}
+
+/**
+ * @brief checks one drive side for slip and finds its best ground speed estimate
+ * @details A side is slipping when its front and back wheels disagree by more than SLIP_VELOCITY_SPLIT, or
+ * when its fastest wheel speeds up more than SLIP_ACCELERATION_MARGIN past where a gripping side would be.
+ * A gripping side follows a first-order response toward the command it was last given, closing the
+ * fraction response of the gap each tick, so the normal spin-up after a step command is never mistaken for
+ * slip. The slower wheel is taken as the ground speed, since a slipping wheel can only spin faster than the
+ * ground. Disconnected motors are left out.
+ * @param frontMotor VEX V5 motor at the front of the side
+ * @param backMotor VEX V5 motor at the back of the side
+ * @param lastCommand double percent command the side was given last tick, after any traction limit
+ * @param lastVelocity double fastest wheel velocity last tick, updated
+ * @param groundVelocity double set to the slower wheel's percent velocity
+ * @returns bool true if the side is slipping
+ * @date 10/18/2026
+ */
+bool TractionControl::checkSide(vex::motor &frontMotor, vex::motor &backMotor, double lastCommand, double &lastVelocity, double &groundVelocity)
+{
+  bool frontInstalled = frontMotor.installed();
+  bool backInstalled = backMotor.installed();
+  double frontVelocity = frontInstalled ? frontMotor.velocity(vex::velocityUnits::pct) : 0;
+  double backVelocity = backInstalled ? backMotor.velocity(vex::velocityUnits::pct) : 0;
+
+  double fastestVelocity;
+  if (frontInstalled && backInstalled)
+  {
+    fastestVelocity = fabs(frontVelocity) > fabs(backVelocity) ? frontVelocity : backVelocity;
+    groundVelocity = fabs(frontVelocity) > fabs(backVelocity) ? backVelocity : frontVelocity;
+  }
+  else
+  {
+    fastestVelocity = frontInstalled ? frontVelocity : backVelocity;
+    groundVelocity = fastestVelocity;
+  }
+
+  bool splitSlip = frontInstalled && backInstalled && fabs(frontVelocity - backVelocity) > SLIP_VELOCITY_SPLIT;
+  double expectedVelocity = lastVelocity + response * (lastCommand - lastVelocity);
+  bool accelerationSlip = fabs(fastestVelocity) > fabs(expectedVelocity) + SLIP_ACCELERATION_MARGIN && fabs(fastestVelocity) > fabs(lastVelocity);
+
+  lastVelocity = fastestVelocity;
+  return splitSlip || accelerationSlip;
+}
+
+/**
+ * @brief checks both drive sides for slip and limits the slipping side's command in the same tick
+ * @details A slipping side's command is held to TRACTION_MARGIN above its ground speed until the wheels
+ * grip again, so the side keeps accelerating as fast as traction allows instead of spinning in place.
+ * Each side's odometry position is advanced with slipping samples discounted. The limited commands are
+ * kept, since they are what each side is responding to next tick.
+ * @relates usercontrol()
+ * @param leftCommand double percent command for the left side, reduced if the left side slips
+ * @param rightCommand double percent command for the right side, reduced if the right side slips
+ * @date 10/18/2026
+ */
+void TractionControl::apply(double &leftCommand, double &rightCommand)
+{
+  double leftGroundVelocity;
+  double rightGroundVelocity;
+  leftSlipping = checkSide(leftFront, leftBack, lastLeftCommand, lastLeftVelocity, leftGroundVelocity);
+  rightSlipping = checkSide(rightFront, rightBack, lastRightCommand, lastRightVelocity, rightGroundVelocity);
+  updateSidePosition(leftFront, leftBack, leftSlipping, lastLeftFrontPosition, lastLeftBackPosition, leftPosition);
+  updateSidePosition(rightFront, rightBack, rightSlipping, lastRightFrontPosition, lastRightBackPosition, rightPosition);
+
+  if (leftSlipping && fabs(leftCommand) > fabs(leftGroundVelocity) + TRACTION_MARGIN)
+  {
+    leftCommand = (leftCommand > 0 ? 1 : -1) * (fabs(leftGroundVelocity) + TRACTION_MARGIN);
+  }
+  if (rightSlipping && fabs(rightCommand) > fabs(rightGroundVelocity) + TRACTION_MARGIN)
+  {
+    rightCommand = (rightCommand > 0 ? 1 : -1) * (fabs(rightGroundVelocity) + TRACTION_MARGIN);
+  }
+  lastLeftCommand = leftCommand;
+  lastRightCommand = rightCommand;
+}
+
+/**
+ * @brief returns whether the left side was slipping at the last apply()
+ * @date 10/18/2026
+ */
+bool TractionControl::isLeftSlipping()
+{
+  return leftSlipping;
+}
+
+/**
+ * @brief returns whether the right side was slipping at the last apply()
+ * @date 10/18/2026
+ */
+bool TractionControl::isRightSlipping()
+{
+  return rightSlipping;
+}
+
+/**
+ * @brief advances one side's odometry position, discounting a slipping wheel
+ * @details While the side slips only the wheel that moved least this tick is trusted, since the other has
+ * spun past the ground. Otherwise both wheels are averaged. Disconnected motors are left out.
+ * @param frontMotor VEX V5 motor at the front of the side
+ * @param backMotor VEX V5 motor at the back of the side
+ * @param slipping bool whether the side is slipping
+ * @param lastFrontPosition double front motor position last tick, updated
+ * @param lastBackPosition double back motor position last tick, updated
+ * @param sidePosition double side position in motor degrees, advanced by this tick's trusted travel
+ * @date 10/18/2026
+ */
+void TractionControl::updateSidePosition(vex::motor &frontMotor, vex::motor &backMotor, bool slipping, double &lastFrontPosition, double &lastBackPosition, double &sidePosition)
+{
+  double frontPosition = frontMotor.position(vex::rotationUnits::deg);
+  double backPosition = backMotor.position(vex::rotationUnits::deg);
+  double frontTravel = frontPosition - lastFrontPosition;
+  double backTravel = backPosition - lastBackPosition;
+  lastFrontPosition = frontPosition;
+  lastBackPosition = backPosition;
+
+  if (!frontMotor.installed())
+  {
+    sidePosition += backTravel;
+  }
+  else if (!backMotor.installed())
+  {
+    sidePosition += frontTravel;
+  }
+  else if (slipping)
+  {
+    sidePosition += fabs(frontTravel) < fabs(backTravel) ? frontTravel : backTravel;
+  }
+  else
+  {
+    sidePosition += (frontTravel + backTravel) / 2.0;
+  }
+}
+
+/**
+ * @brief left side travel in motor degrees for odometry, with slipping samples discounted
+ * @date 10/18/2026
+ */
+double TractionControl::getLeftPosition()
+{
+  return leftPosition;
+}
+
+/**
+ * @brief right side travel in motor degrees for odometry, with slipping samples discounted
+ * @date 10/18/2026
+ */
+double TractionControl::getRightPosition()
+{
+  return rightPosition;
+}
@@ -0,0 +1,233 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       route-compiler.cpp                                        */
+/*    Created:      10/18/2026                                                */
+/*    Description:  Host tool that compiles recorded route files into         */
+/*                  compressed constexpr tables linked into the program       */
+/*                                                                            */
+/*    Build:        g++ -std=c++11 -Iinclude tools/route-compiler.cpp         */
+/*                      src/route-codec.cpp src/route-model.cpp               */
+/*                      src/route-simplify.cpp src/route-retime.cpp       */
+/*                      -o route-compiler                                     */
+/*    Usage:        ./route-compiler [--simplify=IN,DEG,DEG]                  */
+/*                      [--retime=SCALE,AMPS] include/route-tables.h          */
+/*                      MAIN_AUTON_ROUTE=routes/main.bin [NAME=file.bin ...]  */
+/*                  --simplify drops records playback can rebuild within      */
+/*                  IN inches and DEG degrees of heading, and DEG degrees of  */
+/*                  arm and intake position                                   */
+/*                  --retime keeps each route's path but gives it the         */
+/*                  fastest timing at SCALE of top speed and AMPS per motor   */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "route-codec.h"
+#include "route-retime.h"
+#include "route-simplify.h"
+
+// Bytes of table per line of the generated header
+const int BYTES_PER_LINE = 16;
+// Largest position error in degrees the round trip may show, half of one stored unit plus float rounding
+const double ROUND_TRIP_TOLERANCE = 0.5 / ROUTE_POSITION_SCALE + 0.01;
+
+/**
+ * @brief reads a route file written by the robot's RouteRecorder
+ * @param fileName const char* route file to read
+ * @param records std::vector<RouteRecord> filled with the file's records
+ * @param checksum uint32_t set to the route checksum of the whole file, as the robot's selector shows it
+ * @returns bool false if the file is missing or not a route of this version
+ * @date 10/18/2026
+ */
+bool readRoute(const char *fileName, std::vector<RouteRecord> &records, uint32_t &checksum)
+{
+  FILE *file = fopen(fileName, "rb");
+  if (file == NULL)
+  {
+    fprintf(stderr, "%s: cannot open\n", fileName);
+    return false;
+  }
+  RouteHeader header;
+  bool valid = fread(&header, sizeof(RouteHeader), 1, file) == 1 && memcmp(header.magic, ROUTE_MAGIC, 4) == 0 &&
+               header.version == ROUTE_VERSION && header.recordSize == sizeof(RouteRecord);
+  checksum = updateRouteChecksum(ROUTE_CHECKSUM_SEED, (const uint8_t *)&header, sizeof(RouteHeader));
+  RouteRecord record;
+  while (valid && fread(&record, sizeof(RouteRecord), 1, file) == 1)
+  {
+    records.push_back(record);
+    checksum = updateRouteChecksum(checksum, (const uint8_t *)&record, sizeof(RouteRecord));
+  }
+  fclose(file);
+  if (!valid)
+  {
+    fprintf(stderr, "%s: not a version %d route\n", fileName, ROUTE_VERSION);
+  }
+  return valid && !records.empty();
+}
+
+/**
+ * @brief decodes a compressed route and returns its largest position error against the original records
+ * @param data std::vector<uint8_t> compressed route
+ * @param records std::vector<RouteRecord> records it was compressed from
+ * @returns double largest error in degrees, or a huge value if times, flags or record count differ
+ * @date 10/18/2026
+ */
+double checkRoundTrip(const std::vector<uint8_t> &data, const std::vector<RouteRecord> &records)
+{
+  RouteTable table = {data.data(), (int)data.size(), (int)records.size(), 0, 0};
+  RouteTableSource source = RouteTableSource(table);
+  double largestError = 0;
+  RouteRecord decoded;
+  for (size_t i = 0; i < records.size(); i++)
+  {
+    if (!source.next(decoded) || decoded.time != records[i].time || decoded.flags != records[i].flags)
+    {
+      return HUGE_VAL;
+    }
+    for (int j = 0; j < NUMBER_OF_ROUTE_CHANNELS; j++)
+    {
+      largestError = fmax(largestError, fabs(decoded.positions[j] - records[i].positions[j]));
+    }
+  }
+  return source.next(decoded) ? HUGE_VAL : largestError;
+}
+
+/**
+ * @brief compiles each NAME=file.bin argument into a constexpr RouteTable, with its duration and checksum, in one generated header
+ * @details With --simplify each route is first cut down by RouteSimplifier and its report printed, and with
+ * --retime it is then given new timing by RouteRetimer, printing the predicted duration against the recorded one. Every
+ * route is checked by decoding it again before anything is written, and a size report is printed: raw is
+ * the record bytes going in, compressed is the table linked into the program.
+ * @returns int 0 on success, 1 if any route could not be read or did not round trip
+ * @date 10/18/2026
+ */
+int main(int argc, char **argv)
+{
+  bool simplifying = false;
+  double positionTolerance = 0;
+  double headingTolerance = 0;
+  double mechanismTolerance = 0;
+  bool retiming = false;
+  double speedScale = 0;
+  double maxCurrent = 0;
+  int firstArgument = 1;
+  if (argc > firstArgument && strncmp(argv[firstArgument], "--simplify=", 11) == 0)
+  {
+    simplifying = sscanf(argv[firstArgument] + 11, "%lf,%lf,%lf", &positionTolerance, &headingTolerance, &mechanismTolerance) == 3 &&
+                  positionTolerance > 0 && headingTolerance > 0 && mechanismTolerance > 0;
+    if (!simplifying)
+    {
+      fprintf(stderr, "%s: expected --simplify=INCHES,DEGREES,DEGREES\n", argv[firstArgument]);
+      return 1;
+    }
+    firstArgument++;
+  }
+  if (argc > firstArgument && strncmp(argv[firstArgument], "--retime=", 9) == 0)
+  {
+    retiming = sscanf(argv[firstArgument] + 9, "%lf,%lf", &speedScale, &maxCurrent) == 2 &&
+               speedScale > 0 && speedScale <= 1 && maxCurrent > 0;
+    if (!retiming)
+    {
+      fprintf(stderr, "%s: expected --retime=SCALE,AMPS with SCALE from 0 to 1\n", argv[firstArgument]);
+      return 1;
+    }
+    firstArgument++;
+  }
+  if (argc < firstArgument + 2)
+  {
+    fprintf(stderr, "usage: %s [--simplify=INCHES,DEGREES,DEGREES] [--retime=SCALE,AMPS] output.h NAME=route.bin [NAME=route.bin ...]\n", argv[0]);
+    return 1;
+  }
+
+  std::string output = "#ifndef ROUTE_TABLES_H\n#define ROUTE_TABLES_H\n\n";
+  output += "// Generated by tools/route-compiler.cpp from recorded route files - DO NOT EDIT, re-run the compiler instead:\n//  ";
+  for (int i = 1; i < argc; i++)
+  {
+    output += std::string(" ") + argv[i];
+  }
+  output += "\n\n";
+  output += "#include \"route-codec.h\"\n";
+  for (int i = firstArgument + 1; i < argc; i++)
+  {
+    const char *separator = strchr(argv[i], '=');
+    if (separator == NULL)
+    {
+      fprintf(stderr, "%s: expected NAME=route.bin\n", argv[i]);
+      return 1;
+    }
+    std::string name = std::string(argv[i], separator - argv[i]);
+    const char *fileName = separator + 1;
+
+    std::vector<RouteRecord> records;
+    uint32_t fileChecksum;
+    if (!readRoute(fileName, records, fileChecksum))
+    {
+      return 1;
+    }
+    if (simplifying)
+    {
+      RouteSimplifier simplifier = RouteSimplifier(positionTolerance, headingTolerance, mechanismTolerance);
+      records = simplifier.simplify(records);
+      printf("%s: simplified within %g in, %g deg heading, %g deg mechanisms: %d of %d records kept (%.0f%% fewer), "
+             "worst rebuilt record %.0f%% of tolerance, still plays in %.2f sec\n",
+             name.c_str(), positionTolerance, headingTolerance, mechanismTolerance, simplifier.getSimplifiedPoints(),
+             simplifier.getOriginalPoints(), 100.0 * (simplifier.getOriginalPoints() - simplifier.getSimplifiedPoints()) / simplifier.getOriginalPoints(),
+             100 * simplifier.getMaxError(), simplifier.getDuration());
+    }
+    if (retiming)
+    {
+      RouteRetimer retimer = RouteRetimer(speedScale, maxCurrent);
+      records = retimer.retime(records);
+      printf("%s: retimed at %.0f%% of top speed and %g A per motor: predicted %.2f sec instead of %.2f sec recorded (%.2f sec saved)\n",
+             name.c_str(), 100 * speedScale, maxCurrent, retimer.getRetimedDuration(), retimer.getOriginalDuration(),
+             retimer.getOriginalDuration() - retimer.getRetimedDuration());
+    }
+    RouteEncoder encoder;
+    for (size_t j = 0; j < records.size(); j++)
+    {
+      encoder.add(records[j]);
+    }
+    const std::vector<uint8_t> &data = encoder.getData();
+    double error = checkRoundTrip(data, records);
+    if (error > ROUND_TRIP_TOLERANCE)
+    {
+      fprintf(stderr, "%s: round trip failed, error %g degrees\n", fileName, error);
+      return 1;
+    }
+
+    int rawSize = records.size() * sizeof(RouteRecord);
+    uint32_t duration = records.back().time - records.front().time;
+    uint32_t checksum = updateRouteChecksum(ROUTE_CHECKSUM_SEED, data.data(), data.size());
+    printf("%s: %d records, %.2f sec, %d bytes raw, %d bytes compressed (%.1fx), round trip error %.3f deg, "
+           "checksum %08X (file %08X)\n",
+           name.c_str(), (int)records.size(), duration / 1000.0, rawSize, (int)data.size(), (double)rawSize / data.size(), error,
+           checksum, fileChecksum);
+
+    char line[128];
+    snprintf(line, sizeof(line), "\n// %s: %d records, %.2f sec, %d bytes\n", fileName, (int)records.size(), duration / 1000.0, (int)data.size());
+    output += line;
+    output += "constexpr uint8_t " + name + "_DATA[] = {";
+    for (size_t j = 0; j < data.size(); j++)
+    {
+      snprintf(line, sizeof(line), "%s0x%02X%s", j % BYTES_PER_LINE == 0 ? "\n    " : " ", data[j], j + 1 < data.size() ? "," : "");
+      output += line;
+    }
+    snprintf(line, sizeof(line), "\n};\nconstexpr RouteTable %s = {%s_DATA, sizeof(%s_DATA), %d, %u, 0x%08X};\n", name.c_str(), name.c_str(),
+             name.c_str(), (int)records.size(), duration, checksum);
+    output += line;
+  }
+  output += "\n#endif\n";
+
+  FILE *file = fopen(argv[firstArgument], "w");
+  if (file == NULL)
+  {
+    fprintf(stderr, "%s: cannot write\n", argv[firstArgument]);
+    return 1;
+  }
+  fputs(output.c_str(), file);
+  fclose(file);
+  return 0;
+}
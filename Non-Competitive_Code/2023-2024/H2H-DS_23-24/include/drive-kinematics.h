@@ -0,0 +1,30 @@
+#ifndef DRIVE_KINEMATICS_H //Header File Guard
+#define DRIVE_KINEMATICS_H //Header File Guard
+
+using namespace vex; //VEX References
+
+//Custom Made DriveKinematics Class Declaration - See drive-kinematics.cpp for full explanation and implementation
+class DriveKinematics{
+    public:
+        enum Wheels {LEFT_FRONT, LEFT_BACK, RIGHT_FRONT, RIGHT_BACK, NUMBER_OF_WHEELS};
+
+        DriveKinematics(motor newLeftFront, motor newLeftBack, motor newRightFront, motor newRightBack);
+        void update();
+        void spin(double leftVelocity, double rightVelocity);
+        void spinFor(double leftDegrees, double rightDegrees, double velocity);
+        double getGain(int wheel);
+        double getSpeedLimit();
+        int getWorkingMotors();
+
+    private:
+        vex::motor wheels[NUMBER_OF_WHEELS];
+        double gains[NUMBER_OF_WHEELS]; //Fraction of its side's command each motor gets, 0 when lost
+        double speedLimit; //Fraction of top speed the weaker side can keep up with
+        int workingMotors;
+        bool isLeftWheel(int wheel);
+};
+
+//Declaration of DriveKinematics Class Instance
+extern DriveKinematics driveKinematics;
+
+#endif //Header File Guard
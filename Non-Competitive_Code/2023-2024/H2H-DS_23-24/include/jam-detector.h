@@ -0,0 +1,26 @@
+#ifndef JAM_DETECTOR_H //Header File Guard
+#define JAM_DETECTOR_H //Header File Guard
+
+using namespace vex; //VEX References
+#include <string> //std::string
+
+//Custom Made JamDetector Class Declaration - See jam-detector.cpp for full explanation and implementation
+class JamDetector{
+    public:
+        JamDetector(motor newIntakeMotor, std::string newMotorName);
+        void update(double commandedVelocity);
+        bool isClearing();
+        int getJamCount();
+
+    private:
+        vex::motor intakeMotor;
+        std::string motorName;
+        double lastCommandedVelocity;
+        int spinUpTicks;
+        int stalledTicks;
+        bool clearing;
+        int jamCount;
+        vex::timer clearTimer;
+};
+
+#endif //Header File Guard
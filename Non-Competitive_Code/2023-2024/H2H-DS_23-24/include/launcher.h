@@ -0,0 +1,49 @@
+#ifndef LAUNCHER_H //Header File Guard
+#define LAUNCHER_H //Header File Guard
+
+using namespace vex; //VEX References
+#include <vector> //std::vector
+
+//Custom Made Launcher Class Declaration - See launcher.cpp for full explanation and implementation
+class Launcher{
+    public:
+        enum LauncherStates {IDLE, PRIMING, PRIMED, FIRING};
+
+        Launcher(double newDegreesPerCycle, double newPrimedPosition, double newLoadedCurrent);
+        void addMotor(motor newMotor);
+        void prime();
+        void fire();
+        void setContinuous(bool newContinuous);
+        void update();
+        bool isPrimed();
+        int getShotCount();
+        double getLastCycleTime();
+        double getLastFireLatency();
+        double getShotsPerMinute();
+
+    private:
+        std::vector<vex::motor> motorList;
+        double degreesPerCycle; //Motor degrees per full slip gear cycle (one shot)
+        double primedPosition; //Motor degrees past the release point where the launcher is fully loaded
+        double loadedCurrent; //Amps drawn while the launcher is loaded and about to slip
+        LauncherStates state;
+        bool continuous;
+        double cycleZero; //Motor position of the last release, start of the current cycle
+        double primedTarget;
+        double lastCurrent;
+        double lastReleaseTime;
+        double fireRequestTime;
+        bool releaseInStreak;
+        int shotCount;
+        double lastCycleTime;
+        double lastFireLatency;
+        double totalCycleTime;
+        int cycleCount;
+        vex::timer launcherTimer;
+        double getPosition();
+        double getCurrent();
+        bool checkRelease(double position, double current);
+        void startPriming(double position);
+};
+
+#endif //Header File Guard
@@ -8,6 +8,7 @@
 
 #include "vex.h" //VEX functions and subsequent call to robot-config.h
 #include "auton.h" //Autonomous Functions
+#include "drive-kinematics.h" //DriveKinematics Class for moves that survive a lost drive motor
 #include <string> //std::string
 using namespace vex; //VEX references
 
@@ -33,10 +34,7 @@ void turn(int degrees, std::string direction, int velocity){
     if(direction == "left"){
         motorDegrees *= -1;
     }
-    leftFront.spinFor(vex::directionType::fwd, motorDegrees, vex::rotationUnits::deg, velocity, vex::velocityUnits::pct, false);
-    leftBack.spinFor(vex::directionType::fwd, motorDegrees, vex::rotationUnits::deg, velocity, vex::velocityUnits::pct, false);
-    rightFront.spinFor(vex::directionType::fwd, motorDegrees * -1, vex::rotationUnits::deg, velocity, vex::velocityUnits::pct, false);
-    rightBack.spinFor(vex::directionType::fwd, motorDegrees * -1, vex::rotationUnits::deg, velocity, vex::velocityUnits::pct, true);
+    driveKinematics.spinFor(motorDegrees, motorDegrees * -1, velocity); //Working motors only, slower if any are lost
 }
 
 /*------------------------------------------------------------------------------------*/
@@ -61,8 +59,5 @@ void drive(int inches, std::string direction, int velocity){
     if(direction == "rev"){
         motorDegrees *= -1;
     }
-    leftFront.spinFor(vex::directionType::fwd, motorDegrees, vex::rotationUnits::deg, velocity, vex::velocityUnits::pct, false);
-    leftBack.spinFor(vex::directionType::fwd, motorDegrees, vex::rotationUnits::deg, velocity, vex::velocityUnits::pct, false);
-    rightFront.spinFor(vex::directionType::fwd, motorDegrees, vex::rotationUnits::deg, velocity, vex::velocityUnits::pct, false);
-    rightBack.spinFor(vex::directionType::fwd, motorDegrees, vex::rotationUnits::deg, velocity, vex::velocityUnits::pct, true);
+    driveKinematics.spinFor(motorDegrees, motorDegrees, velocity); //Working motors only, slower if any are lost
 }
\ No newline at end of file
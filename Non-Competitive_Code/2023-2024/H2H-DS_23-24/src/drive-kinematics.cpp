@@ -0,0 +1,126 @@
+/*------------------------------------------------------------------------------------*/
+/*                                                                                    */
+/*                              Global References                                     */
+/*                                                                                    */
+/*  Necessary #include and using calls                                                */
+/*                                                                                    */
+/*------------------------------------------------------------------------------------*/
+
+#include "vex.h" //VEX functions and subsequent call to robot-config.h
+#include "drive-kinematics.h" //DriveKinematics Class Declaration
+using namespace vex; //VEX references
+
+/*------------------------------------------------------------------------------------*/
+/*                                                                                    */
+/*                              DriveKinematics Class                                 */
+/*                                                                                    */
+/*  Maps the left and right stick (or autonomous side moves) onto whichever drive     */
+/*  motors are still connected. A side's command only ever goes to motors on that     */
+/*  side, so any subset of working motors keeps tank steering - a diagonal pair no    */
+/*  longer puts the left stick on a right motor.                                      */
+/*                                                                                    */
+/*  The side with fewer working motors sets a speed limit: top speed drops by         */
+/*  DEGRADED_SPEED_DROP times the fraction of that side's motors that are lost, so    */
+/*  a lone motor has the torque headroom to keep pace with the other side. A lost     */
+/*  motor costs speed but not control.                                                */
+/*                                                                                    */
+/*  spinFor() stops waiting on a motor that unplugs mid-move, and gives the whole     */
+/*  move up after MOVE_TIMEOUT_FACTOR times its expected time plus                    */
+/*  MOVE_TIMEOUT_MARGIN, so a stalled motor cannot hang autonomous.                   */
+/*                                                                                    */
+/*------------------------------------------------------------------------------------*/
+
+//Fraction of top speed given up as the weaker side goes from two motors to none
+const double DEGRADED_SPEED_DROP = 0.5;
+//Motors on each side of the drive when all of them work
+const int MOTORS_PER_SIDE = 2;
+//Motor degrees per second at full speed with the drive's 200 rpm green cartridges
+const double DRIVE_MAX_VELOCITY = 1200;
+//Multiple of a move's expected time, plus milliseconds to get moving, before a move is given up on
+const double MOVE_TIMEOUT_FACTOR = 2;
+const double MOVE_TIMEOUT_MARGIN = 500;
+
+DriveKinematics::DriveKinematics(motor newLeftFront, motor newLeftBack, motor newRightFront, motor newRightBack) : wheels{newLeftFront, newLeftBack, newRightFront, newRightBack}{
+    for(int i=0; i<NUMBER_OF_WHEELS; i++){
+        gains[i] = 1;
+    }
+    speedLimit = 1;
+    workingMotors = NUMBER_OF_WHEELS;
+}
+
+bool DriveKinematics::isLeftWheel(int wheel){
+    return wheel == LEFT_FRONT || wheel == LEFT_BACK;
+}
+
+//Recomputes every motor's gain from which drive motors are connected
+void DriveKinematics::update(){
+    int leftMotors = 0;
+    int rightMotors = 0;
+    bool working[NUMBER_OF_WHEELS];
+    for(int i=0; i<NUMBER_OF_WHEELS; i++){
+        working[i] = wheels[i].installed();
+        if(working[i] && isLeftWheel(i)){
+            leftMotors++;
+        }
+        else if(working[i]){
+            rightMotors++;
+        }
+    }
+
+    int weakerSide = leftMotors < rightMotors ? leftMotors : rightMotors;
+    speedLimit = 1 - DEGRADED_SPEED_DROP * (MOTORS_PER_SIDE - weakerSide) / MOTORS_PER_SIDE;
+    for(int i=0; i<NUMBER_OF_WHEELS; i++){
+        gains[i] = working[i] ? speedLimit : 0;
+    }
+    workingMotors = leftMotors + rightMotors;
+}
+
+//Drives each working motor with its own side's velocity scaled by its gain
+void DriveKinematics::spin(double leftVelocity, double rightVelocity){
+    update();
+    for(int i=0; i<NUMBER_OF_WHEELS; i++){
+        if(gains[i] > 0){
+            wheels[i].spin(vex::directionType::fwd, (isLeftWheel(i) ? leftVelocity : rightVelocity) * gains[i], vex::velocityUnits::pct);
+        }
+    }
+}
+
+//Relative move of each side at the limited speed; waits on every working motor, never on a lost one
+void DriveKinematics::spinFor(double leftDegrees, double rightDegrees, double velocity){
+    update();
+    for(int i=0; i<NUMBER_OF_WHEELS; i++){
+        if(gains[i] > 0){
+            wheels[i].spinFor(vex::directionType::fwd, isLeftWheel(i) ? leftDegrees : rightDegrees, vex::rotationUnits::deg, velocity * gains[i], vex::velocityUnits::pct, false);
+        }
+    }
+    double moveVelocity = DRIVE_MAX_VELOCITY * fabs(velocity) * speedLimit / 100;
+    double timeout = MOVE_TIMEOUT_MARGIN;
+    if(moveVelocity > 0){
+        timeout += MOVE_TIMEOUT_FACTOR * fmax(fabs(leftDegrees), fabs(rightDegrees)) / moveVelocity * 1000;
+    }
+    vex::timer moveTimer;
+    for(int i=0; i<NUMBER_OF_WHEELS; i++){
+        while(gains[i] > 0 && !wheels[i].isDone() && wheels[i].installed() && moveTimer.time(vex::timeUnits::msec) < timeout){
+            wait(10, msec);
+        }
+    }
+    if(moveTimer.time(vex::timeUnits::msec) >= timeout){
+        printf("Drive move timed out after %.0f msec\n", timeout);
+        for(int i=0; i<NUMBER_OF_WHEELS; i++){
+            wheels[i].stop();
+        }
+    }
+    update();
+}
+
+double DriveKinematics::getGain(int wheel){
+    return gains[wheel];
+}
+
+double DriveKinematics::getSpeedLimit(){
+    return speedLimit;
+}
+
+int DriveKinematics::getWorkingMotors(){
+    return workingMotors;
+}
@@ -0,0 +1,100 @@
+/*------------------------------------------------------------------------------------*/
+/*                                                                                    */
+/*                              Global References                                     */
+/*                                                                                    */
+/*  Necessary #include and using calls                                                */
+/*                                                                                    */
+/*------------------------------------------------------------------------------------*/
+
+#include "vex.h" //VEX functions and subsequent call to robot-config.h
+#include "jam-detector.h" //JamDetector Class Declaration
+#include <string> //std::string
+using namespace vex; //VEX references
+
+/*------------------------------------------------------------------------------------*/
+/*                                                                                    */
+/*                              Jam Detector Class                                    */
+/*                                                                                    */
+/*  Drives one intake motor and clears jams without waiting on the driver. A jam is   */
+/*  flagged when the motor draws more than JAM_CURRENT while turning slower than      */
+/*  JAM_VELOCITY for JAM_TICKS ticks in a row. The motor is then reversed for         */
+/*  CLEAR_TIME msec before the commanded velocity resumes. Every jam is counted and   */
+/*  printed to the terminal.                                                          */
+/*                                                                                    */
+/*  update() must be called once every control tick (20 msec) in place of spin/stop.  */
+/*                                                                                    */
+/*------------------------------------------------------------------------------------*/
+
+//Amps above which a commanded intake motor is considered loaded
+const double JAM_CURRENT = 2.0;
+//Percent velocity below which a loaded intake motor is considered stalled
+const double JAM_VELOCITY = 5.0;
+//Consecutive stalled ticks before a jam is flagged
+const int JAM_TICKS = 3;
+//Ticks after a new command during which spin-up current is ignored
+const int SPIN_UP_TICKS = 5;
+//Milliseconds the intake motor is reversed for to clear a jam
+const double CLEAR_TIME = 150;
+
+JamDetector::JamDetector(motor newIntakeMotor, std::string newMotorName) : intakeMotor(newIntakeMotor), motorName(newMotorName){
+    lastCommandedVelocity = 0;
+    spinUpTicks = 0;
+    stalledTicks = 0;
+    clearing = false;
+    jamCount = 0;
+}
+
+void JamDetector::update(double commandedVelocity){
+    //A new command restarts spin-up and cancels any reverse pulse
+    if(commandedVelocity != lastCommandedVelocity){
+        lastCommandedVelocity = commandedVelocity;
+        spinUpTicks = 0;
+        stalledTicks = 0;
+        clearing = false;
+    }
+
+    if(commandedVelocity == 0){
+        intakeMotor.stop();
+        return;
+    }
+
+    if(clearing){
+        if(clearTimer.time(vex::timeUnits::msec) < CLEAR_TIME){
+            intakeMotor.spin(vex::directionType::fwd, -commandedVelocity, vex::velocityUnits::pct);
+            return;
+        }
+        clearing = false;
+        spinUpTicks = 0;
+    }
+
+    intakeMotor.spin(vex::directionType::fwd, commandedVelocity, vex::velocityUnits::pct);
+
+    if(spinUpTicks < SPIN_UP_TICKS){
+        spinUpTicks++;
+        return;
+    }
+
+    if(intakeMotor.current(vex::currentUnits::amp) > JAM_CURRENT && fabs(intakeMotor.velocity(vex::velocityUnits::pct)) < JAM_VELOCITY){
+        stalledTicks++;
+    }
+    else{
+        stalledTicks = 0;
+    }
+
+    if(stalledTicks >= JAM_TICKS){
+        jamCount++;
+        stalledTicks = 0;
+        clearing = true;
+        clearTimer.clear();
+        printf("Intake jam %d on %s, reversing for %.0f msec\n", jamCount, motorName.c_str(), CLEAR_TIME);
+        intakeMotor.spin(vex::directionType::fwd, -commandedVelocity, vex::velocityUnits::pct);
+    }
+}
+
+bool JamDetector::isClearing(){
+    return clearing;
+}
+
+int JamDetector::getJamCount(){
+    return jamCount;
+}
@@ -18,9 +18,15 @@
 #include "vex.h" //VEX functions and subsequent call to robot-config.h
 #include "auton.h" //Autonomous functions
 #include "gui.h" //GUI functions
+#include "launcher.h" //Launcher class
+#include "jam-detector.h" //JamDetector class
+#include "drive-kinematics.h" //DriveKinematics class
 using namespace vex; //VEX References
 
 MotorCollection myMotorCollection; //Init instance of MotorCollection class to use for recurring motor testing
+Launcher puncherLauncher = Launcher(360, 330, 2.0); //Init instance of Launcher class: 360deg per slip gear cycle, primed 330deg past release, 2.0A while loaded - tune on robot
+JamDetector intakeJamDetector = JamDetector(intake, "I"); //Init instance of JamDetector class that drives the intake and clears jams
+DriveKinematics driveKinematics = DriveKinematics(leftFront, leftBack, rightFront, rightBack); //Init instance of DriveKinematics class that drives whichever drive motors still work
 
 /*------------------------------------------------------------------------------------*/
 /*                          Pre-Autonomous Functions                                  */
@@ -56,6 +62,9 @@ void pre_auton(void) {
   myMotorCollection.addMotor(puncher, "P");
   myMotorCollection.addMotor(leftWing, "LW");
   myMotorCollection.addMotor(rightWing, "RW");
+
+  //Adds the puncher motor to the puncherLauncher instance of Launcher Class
+  puncherLauncher.addMotor(puncher);
 }
 
 /*------------------------------------------------------------------------------------*/
@@ -135,6 +144,8 @@ void usercontrol(void) {
   bool intakeRevLastState = false;
   bool puncherState = false;
   bool puncherLastState = false;
+  bool puncherFireLastState = false;
+  puncherLauncher.prime(); //Loads the puncher so the first shot fires instantly
 
   // User control code here, inside the loop
   while (1) {
@@ -149,33 +160,12 @@ void usercontrol(void) {
     /*                              Wheel Controls                                        */
     /*                                                                                    */
     /*  Drive with the left motors being controlled by the left joystick and the right    */
-    /*  motors being controlled by the right joystick. Different drive modes determined   */
-    /*  by driveConfig str as switched if motors disconnect.                              */  
+    /*  motors being controlled by the right joystick. If motors disconnect,              */
+    /*  driveKinematics keeps each stick on its own side's remaining motors, slower.      */
     /*                                                                                    */
     /*------------------------------------------------------------------------------------*/
 
-    if(driveConfig == "rearWheel"){
-      leftBack.spin(vex::directionType::fwd, Controller1.Axis3.position(), vex::velocityUnits::pct);
-      rightBack.spin(vex::directionType::fwd, Controller1.Axis2.position(), vex::velocityUnits::pct); 
-    }
-    else if(driveConfig == "frontWheel"){
-      leftFront.spin(vex::directionType::fwd, Controller1.Axis3.position(), vex::velocityUnits::pct);
-      rightFront.spin(vex::directionType::fwd, Controller1.Axis2.position(), vex::velocityUnits::pct); 
-    }
-    else if(driveConfig == "RFLB"){
-      rightFront.spin(vex::directionType::fwd, Controller1.Axis3.position(), vex::velocityUnits::pct);
-      leftBack.spin(vex::directionType::fwd, Controller1.Axis2.position(), vex::velocityUnits::pct);     
-    }
-    else if(driveConfig == "LFRB"){
-      leftFront.spin(vex::directionType::fwd, Controller1.Axis3.position(), vex::velocityUnits::pct);
-      rightBack.spin(vex::directionType::fwd, Controller1.Axis2.position(), vex::velocityUnits::pct);     
-    }
-    else{
-      leftFront.spin(vex::directionType::fwd, Controller1.Axis3.position(), vex::velocityUnits::pct);
-      leftBack.spin(vex::directionType::fwd, Controller1.Axis3.position(), vex::velocityUnits::pct);
-      rightFront.spin(vex::directionType::fwd, Controller1.Axis2.position(), vex::velocityUnits::pct); 
-      rightBack.spin(vex::directionType::fwd, Controller1.Axis2.position(), vex::velocityUnits::pct); 
-    }
+    driveKinematics.spin(Controller1.Axis3.position(), Controller1.Axis2.position());
 
 
     /*------------------------------------------------------------------------------------*/
@@ -183,6 +173,7 @@ void usercontrol(void) {
     /*                              Intake Controls                                       */
     /*                                                                                    */
     /*  One green motor that turns fwd/rev at 100% velocity to intake/outtake triballs    */
+    /*  driven through intakeJamDetector, which reverses briefly to clear jams            */
     /*  Controls: Intake - X, Outtake - B                                                 */  
     /*                                                                                    */
     /*------------------------------------------------------------------------------------*/
@@ -199,7 +190,7 @@ void usercontrol(void) {
             intakeRevState = false;
             intakeRevLastState = false;
           }
-          intake.spin(vex::directionType::fwd, 100, vex::velocityUnits::pct);
+          intakeJamDetector.update(100);
    } 
 
   if(Controller1.ButtonB.pressing() && !intakeRevLastState) {
@@ -213,11 +204,11 @@ void usercontrol(void) {
             intakeFwdState = false;
             intakeFwdLastState = false;
           }
-          intake.spin(vex::directionType::rev, 100, vex::velocityUnits::pct);
+          intakeJamDetector.update(-100);
    } 
 
    if(!intakeFwdState && !intakeRevState){
-    intake.stop();
+    intakeJamDetector.update(0);
    }
  
     /*------------------------------------------------------------------------------------*/
@@ -225,8 +216,9 @@ void usercontrol(void) {
     /*                              Puncher Controls                                      */
     /*                                                                                    */
     /*  One red motor gear-ratioed for torque that turns fwd/rev at 100% velocity         */
-    /*  to launch triballs through a puncher on a slip gear system.                       */
-    /*  Controls: Toggle - Y                                                              */  
+    /*  to launch triballs through a puncher on a slip gear system. puncherLauncher      */
+    /*  counts and times every shot and stops the puncher loaded between shots.           */
+    /*  Controls: Toggle Continuous - Y, Single Shot - A                                  */  
     /*                                                                                    */
     /*------------------------------------------------------------------------------------*/ 
 
@@ -238,11 +230,14 @@ void usercontrol(void) {
       puncherLastState = false;
    }
 
-   if(puncherState) {
-          puncher.spin(vex::directionType::fwd, 100, vex::velocityUnits::pct);
-   } else {
-      puncher.stop();
+   puncherLauncher.setContinuous(puncherState);
+   if(Controller1.ButtonA.pressing() && !puncherState && !puncherFireLastState) {
+      puncherLauncher.fire();
+      puncherFireLastState = true;
+   } else if(!Controller1.ButtonA.pressing()) {
+      puncherFireLastState = false;
    }
+   puncherLauncher.update();
     /*------------------------------------------------------------------------------------*/
     /*                                                                                    */
     /*                              Wing Controls                                         */
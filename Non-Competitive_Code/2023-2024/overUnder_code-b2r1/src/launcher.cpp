@@ -0,0 +1,195 @@
+/*------------------------------------------------------------------------------------*/
+/*                                                                                    */
+/*                              Global References                                     */
+/*                                                                                    */
+/*  Necessary #include and using calls                                                */
+/*                                                                                    */
+/*------------------------------------------------------------------------------------*/
+
+#include "vex.h" //VEX functions and subsequent call to robot-config.h
+#include "launcher.h" //Launcher Class Declaration
+#include <vector> //std::vector
+using namespace vex; //VEX references
+
+/*------------------------------------------------------------------------------------*/
+/*                                                                                    */
+/*                              Launcher Class                                        */
+/*                                                                                    */
+/*  Tracks a slip gear launcher (puncher or catapult) through its cycle so that every */
+/*  shot is detected, counted and timed, and the launcher rests fully loaded between  */
+/*  shots so that it fires the instant it is told to.                                 */
+/*                                                                                    */
+/*  A release is detected when the current drawn while loading collapses as the slip  */
+/*  gear lets go. If the current drop is missed, a full cycle of motor travel since   */
+/*  the last release is counted as a release instead. Current based releases also    */
+/*  re-zero the cycle so that motor backlash and skipped teeth never build up.        */
+/*                                                                                    */
+/*  update() must be called once every control tick (20 msec) and never blocks.      */
+/*                                                                                    */
+/*------------------------------------------------------------------------------------*/
+
+//Fraction of the loaded current the motors must fall below for a release to be counted
+const double RELEASE_CURRENT_RATIO = 0.5;
+//Degrees from the primed position at which the launcher is considered primed
+const double PRIMED_TOLERANCE = 5;
+//Percent velocity the launcher is driven at while firing and priming
+const double LAUNCHER_VELOCITY = 100;
+
+Launcher::Launcher(double newDegreesPerCycle, double newPrimedPosition, double newLoadedCurrent){
+    degreesPerCycle = newDegreesPerCycle;
+    primedPosition = newPrimedPosition;
+    loadedCurrent = newLoadedCurrent;
+    state = IDLE;
+    continuous = false;
+    cycleZero = 0; //Launcher is assumed to start released with encoders reset
+    primedTarget = 0;
+    lastCurrent = 0;
+    lastReleaseTime = 0;
+    fireRequestTime = 0;
+    releaseInStreak = false;
+    shotCount = 0;
+    lastCycleTime = 0;
+    lastFireLatency = 0;
+    totalCycleTime = 0;
+    cycleCount = 0;
+}
+
+void Launcher::addMotor(motor newMotor){
+    motorList.push_back(newMotor);
+}
+
+//Average position of the launcher motors in degrees
+double Launcher::getPosition(){
+    double totalPosition = 0;
+    for(int i=0; i<motorList.size(); i++){
+        totalPosition += motorList[i].position(vex::rotationUnits::deg);
+    }
+    return motorList.empty() ? 0 : totalPosition / motorList.size();
+}
+
+//Average current of the launcher motors in amps
+double Launcher::getCurrent(){
+    double totalCurrent = 0;
+    for(int i=0; i<motorList.size(); i++){
+        totalCurrent += motorList[i].current(vex::currentUnits::amp);
+    }
+    return motorList.empty() ? 0 : totalCurrent / motorList.size();
+}
+
+//Spins to the next primed position ahead of the launcher without blocking
+void Launcher::startPriming(double position){
+    primedTarget = cycleZero + primedPosition;
+    while(primedTarget < position - PRIMED_TOLERANCE){
+        primedTarget += degreesPerCycle;
+    }
+    for(int i=0; i<motorList.size(); i++){
+        motorList[i].spinToPosition(primedTarget, vex::rotationUnits::deg, LAUNCHER_VELOCITY, vex::velocityUnits::pct, false);
+    }
+    state = PRIMING;
+}
+
+//Returns true once per cycle when the slip gear releases
+bool Launcher::checkRelease(double position, double current){
+    double cycleTravel = position - cycleZero;
+
+    //Current collapses as the loaded slip gear lets go; ignored in the first half of a cycle
+    if(cycleTravel > degreesPerCycle / 2 && lastCurrent >= loadedCurrent && current < lastCurrent * RELEASE_CURRENT_RATIO){
+        cycleZero = position;
+        return true;
+    }
+
+    //Fallback if the current drop was missed
+    if(cycleTravel >= degreesPerCycle){
+        cycleZero += degreesPerCycle;
+        return true;
+    }
+    return false;
+}
+
+void Launcher::prime(){
+    continuous = false;
+    startPriming(getPosition());
+}
+
+void Launcher::fire(){
+    if(state == FIRING){
+        return;
+    }
+    fireRequestTime = launcherTimer.time(vex::timeUnits::msec);
+    releaseInStreak = false;
+    for(int i=0; i<motorList.size(); i++){
+        motorList[i].spin(vex::directionType::fwd, LAUNCHER_VELOCITY, vex::velocityUnits::pct);
+    }
+    state = FIRING;
+}
+
+void Launcher::setContinuous(bool newContinuous){
+    if(newContinuous == continuous){
+        return;
+    }
+    continuous = newContinuous;
+    if(continuous){
+        fire();
+    }
+    else if(state == FIRING){
+        startPriming(getPosition()); //Stops loaded at the next primed position
+    }
+}
+
+void Launcher::update(){
+    double position = getPosition();
+    double current = getCurrent();
+    double now = launcherTimer.time(vex::timeUnits::msec);
+
+    if((state == FIRING || state == PRIMING) && checkRelease(position, current)){
+        shotCount++;
+        if(releaseInStreak){
+            lastCycleTime = now - lastReleaseTime;
+            totalCycleTime += lastCycleTime;
+            cycleCount++;
+        }
+        else{
+            lastFireLatency = now - fireRequestTime;
+        }
+        lastReleaseTime = now;
+        releaseInStreak = continuous;
+        printf("Shot %d: cycle %.0f msec, fire latency %.0f msec, %.1f shots/min\n", shotCount, lastCycleTime, lastFireLatency, getShotsPerMinute());
+
+        if(!continuous){
+            startPriming(position);
+        }
+    }
+    else if(state == PRIMING && (fabs(position - primedTarget) < PRIMED_TOLERANCE || (!motorList.empty() && motorList[0].isDone()))){
+        for(int i=0; i<motorList.size(); i++){
+            motorList[i].stop(vex::brakeType::hold);
+        }
+        state = PRIMED;
+    }
+    lastCurrent = current;
+}
+
+bool Launcher::isPrimed(){
+    return state == PRIMED;
+}
+
+int Launcher::getShotCount(){
+    return shotCount;
+}
+
+//Milliseconds between the last two releases while firing continuously
+double Launcher::getLastCycleTime(){
+    return lastCycleTime;
+}
+
+//Milliseconds from the last fire request to its release
+double Launcher::getLastFireLatency(){
+    return lastFireLatency;
+}
+
+//Average continuous fire rate over every measured cycle
+double Launcher::getShotsPerMinute(){
+    if(cycleCount == 0){
+        return 0;
+    }
+    return 60000.0 / (totalCycleTime / cycleCount);
+}
@@ -10,8 +10,12 @@
 //Vex References
 #include "vex.h"
 #include "auton.h"
+#include "launcher.h"
 using namespace vex;
 
+//Catapult launcher: 360deg per slip gear cycle, primed 340deg past release, 2.0A while loaded - tune on robot
+Launcher catapultLauncher = Launcher(360, 340, 2.0);
+
 /*---------------------------------------------------------------------------*/
 /*                          Pre-Autonomous Functions                         */
 /*                                                                           */
@@ -52,6 +56,10 @@ void pre_auton(void) {
   rightSixBarLift.setMaxTorque(100, percent);
   leftCatapult.setMaxTorque(100, percent);
   rightCatapult.setMaxTorque(100, percent);
+
+  //Adds Catapult Motors to the Launcher
+  catapultLauncher.addMotor(leftCatapult);
+  catapultLauncher.addMotor(rightCatapult);
 }
 
 
@@ -97,6 +105,11 @@ void usercontrol(void) {
   //Reset Six Bar Lift
   leftSixBarLift.spinTo(0, vex::rotationUnits::deg, false);
   rightSixBarLift.spinTo(0, vex::rotationUnits::deg); 
+  //Loads the catapult so the first shot fires instantly
+  catapultLauncher.prime();
+  bool catapultState = false;
+  bool catapultLastState = false;
+  bool catapultFireLastState = false;
   // User control code here, inside the loop
   while (1) {
 
@@ -191,7 +204,23 @@ void usercontrol(void) {
   // }
 
 
-
+  //Catapult Controls: Toggle Continuous - Y, Single Shot - X
+  if(Controller1.ButtonY.pressing() && !catapultLastState){
+    catapultState = !catapultState;
+    catapultLastState = true;
+  }
+  else if(!Controller1.ButtonY.pressing()){
+    catapultLastState = false;
+  }
+  catapultLauncher.setContinuous(catapultState);
+  if(Controller1.ButtonX.pressing() && !catapultState && !catapultFireLastState){
+    catapultLauncher.fire();
+    catapultFireLastState = true;
+  }
+  else if(!Controller1.ButtonX.pressing()){
+    catapultFireLastState = false;
+  }
+  catapultLauncher.update();
 
   wait(20, msec);
   }
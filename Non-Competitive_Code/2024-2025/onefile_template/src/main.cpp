@@ -9,6 +9,7 @@
 
 #include "vex.h"
 #include <string>
+#include <vector>
 using namespace vex;
 
 // A global instance of competition
@@ -89,6 +90,347 @@ void drive(int inches, std::string direction, int velocity){
     rightBack.spinFor(vex::directionType::fwd, motorDegrees, vex::rotationUnits::deg, velocity, vex::velocityUnits::pct, true);
 }
 
+/*------------------------------------------------------------------------------------*/
+/*                                                                                    */
+/*                              Launcher Class                                        */
+/*                                                                                    */
+/*  Tracks a slip gear launcher (puncher or catapult) through its cycle so that every */
+/*  shot is detected, counted and timed, and the launcher rests fully loaded between  */
+/*  shots so that it fires the instant it is told to.                                 */
+/*                                                                                    */
+/*  A release is detected when the current drawn while loading collapses as the slip  */
+/*  gear lets go. If the current drop is missed, a full cycle of motor travel since   */
+/*  the last release is counted as a release instead. Current based releases also    */
+/*  re-zero the cycle so that motor backlash and skipped teeth never build up.        */
+/*                                                                                    */
+/*  update() must be called once every control tick (20 msec) and never blocks.      */
+/*                                                                                    */
+/*------------------------------------------------------------------------------------*/
+
+//Fraction of the loaded current the motors must fall below for a release to be counted
+const double RELEASE_CURRENT_RATIO = 0.5;
+//Degrees from the primed position at which the launcher is considered primed
+const double PRIMED_TOLERANCE = 5;
+//Percent velocity the launcher is driven at while firing and priming
+const double LAUNCHER_VELOCITY = 100;
+
+class Launcher{
+    public:
+        enum LauncherStates {IDLE, PRIMING, PRIMED, FIRING};
+
+        Launcher(double newDegreesPerCycle, double newPrimedPosition, double newLoadedCurrent);
+        void addMotor(motor newMotor);
+        void prime();
+        void fire();
+        void setContinuous(bool newContinuous);
+        void update();
+        bool isPrimed();
+        int getShotCount();
+        double getLastCycleTime();
+        double getLastFireLatency();
+        double getShotsPerMinute();
+
+    private:
+        std::vector<vex::motor> motorList;
+        double degreesPerCycle; //Motor degrees per full slip gear cycle (one shot)
+        double primedPosition; //Motor degrees past the release point where the launcher is fully loaded
+        double loadedCurrent; //Amps drawn while the launcher is loaded and about to slip
+        LauncherStates state;
+        bool continuous;
+        double cycleZero; //Motor position of the last release, start of the current cycle
+        double primedTarget;
+        double lastCurrent;
+        double lastReleaseTime;
+        double fireRequestTime;
+        bool releaseInStreak;
+        int shotCount;
+        double lastCycleTime;
+        double lastFireLatency;
+        double totalCycleTime;
+        int cycleCount;
+        vex::timer launcherTimer;
+        double getPosition();
+        double getCurrent();
+        bool checkRelease(double position, double current);
+        void startPriming(double position);
+};
+
+Launcher::Launcher(double newDegreesPerCycle, double newPrimedPosition, double newLoadedCurrent){
+    degreesPerCycle = newDegreesPerCycle;
+    primedPosition = newPrimedPosition;
+    loadedCurrent = newLoadedCurrent;
+    state = IDLE;
+    continuous = false;
+    cycleZero = 0; //Launcher is assumed to start released with encoders reset
+    primedTarget = 0;
+    lastCurrent = 0;
+    lastReleaseTime = 0;
+    fireRequestTime = 0;
+    releaseInStreak = false;
+    shotCount = 0;
+    lastCycleTime = 0;
+    lastFireLatency = 0;
+    totalCycleTime = 0;
+    cycleCount = 0;
+}
+
+void Launcher::addMotor(motor newMotor){
+    motorList.push_back(newMotor);
+}
+
+//Average position of the launcher motors in degrees
+double Launcher::getPosition(){
+    double totalPosition = 0;
+    for(int i=0; i<motorList.size(); i++){
+        totalPosition += motorList[i].position(vex::rotationUnits::deg);
+    }
+    return motorList.empty() ? 0 : totalPosition / motorList.size();
+}
+
+//Average current of the launcher motors in amps
+double Launcher::getCurrent(){
+    double totalCurrent = 0;
+    for(int i=0; i<motorList.size(); i++){
+        totalCurrent += motorList[i].current(vex::currentUnits::amp);
+    }
+    return motorList.empty() ? 0 : totalCurrent / motorList.size();
+}
+
+//Spins to the next primed position ahead of the launcher without blocking
+void Launcher::startPriming(double position){
+    primedTarget = cycleZero + primedPosition;
+    while(primedTarget < position - PRIMED_TOLERANCE){
+        primedTarget += degreesPerCycle;
+    }
+    for(int i=0; i<motorList.size(); i++){
+        motorList[i].spinToPosition(primedTarget, vex::rotationUnits::deg, LAUNCHER_VELOCITY, vex::velocityUnits::pct, false);
+    }
+    state = PRIMING;
+}
+
+//Returns true once per cycle when the slip gear releases
+bool Launcher::checkRelease(double position, double current){
+    double cycleTravel = position - cycleZero;
+
+    //Current collapses as the loaded slip gear lets go; ignored in the first half of a cycle
+    if(cycleTravel > degreesPerCycle / 2 && lastCurrent >= loadedCurrent && current < lastCurrent * RELEASE_CURRENT_RATIO){
+        cycleZero = position;
+        return true;
+    }
+
+    //Fallback if the current drop was missed
+    if(cycleTravel >= degreesPerCycle){
+        cycleZero += degreesPerCycle;
+        return true;
+    }
+    return false;
+}
+
+void Launcher::prime(){
+    continuous = false;
+    startPriming(getPosition());
+}
+
+void Launcher::fire(){
+    if(state == FIRING){
+        return;
+    }
+    fireRequestTime = launcherTimer.time(vex::timeUnits::msec);
+    releaseInStreak = false;
+    for(int i=0; i<motorList.size(); i++){
+        motorList[i].spin(vex::directionType::fwd, LAUNCHER_VELOCITY, vex::velocityUnits::pct);
+    }
+    state = FIRING;
+}
+
+void Launcher::setContinuous(bool newContinuous){
+    if(newContinuous == continuous){
+        return;
+    }
+    continuous = newContinuous;
+    if(continuous){
+        fire();
+    }
+    else if(state == FIRING){
+        startPriming(getPosition()); //Stops loaded at the next primed position
+    }
+}
+
+void Launcher::update(){
+    double position = getPosition();
+    double current = getCurrent();
+    double now = launcherTimer.time(vex::timeUnits::msec);
+
+    if((state == FIRING || state == PRIMING) && checkRelease(position, current)){
+        shotCount++;
+        if(releaseInStreak){
+            lastCycleTime = now - lastReleaseTime;
+            totalCycleTime += lastCycleTime;
+            cycleCount++;
+        }
+        else{
+            lastFireLatency = now - fireRequestTime;
+        }
+        lastReleaseTime = now;
+        releaseInStreak = continuous;
+        printf("Shot %d: cycle %.0f msec, fire latency %.0f msec, %.1f shots/min\n", shotCount, lastCycleTime, lastFireLatency, getShotsPerMinute());
+
+        if(!continuous){
+            startPriming(position);
+        }
+    }
+    else if(state == PRIMING && (fabs(position - primedTarget) < PRIMED_TOLERANCE || (!motorList.empty() && motorList[0].isDone()))){
+        for(int i=0; i<motorList.size(); i++){
+            motorList[i].stop(vex::brakeType::hold);
+        }
+        state = PRIMED;
+    }
+    lastCurrent = current;
+}
+
+bool Launcher::isPrimed(){
+    return state == PRIMED;
+}
+
+int Launcher::getShotCount(){
+    return shotCount;
+}
+
+//Milliseconds between the last two releases while firing continuously
+double Launcher::getLastCycleTime(){
+    return lastCycleTime;
+}
+
+//Milliseconds from the last fire request to its release
+double Launcher::getLastFireLatency(){
+    return lastFireLatency;
+}
+
+//Average continuous fire rate over every measured cycle
+double Launcher::getShotsPerMinute(){
+    if(cycleCount == 0){
+        return 0;
+    }
+    return 60000.0 / (totalCycleTime / cycleCount);
+}
+
+//Puncher launcher: 360deg per slip gear cycle, primed 330deg past release, 2.0A while loaded - tune on robot
+Launcher puncherLauncher = Launcher(360, 330, 2.0);
+
+/*------------------------------------------------------------------------------------*/
+/*                                                                                    */
+/*                              Wing Class                                            */
+/*                                                                                    */
+/*  Opens and closes one 5.5w wing motor without blocking the control loop. The wing  */
+/*  is driven toward its hard stop until it stalls there (high current, low           */
+/*  velocity) and is then held against the stop with a small voltage instead of       */
+/*  straining at full power. If no stall is seen within WING_TRAVEL_TIMEOUT the wing  */
+/*  is assumed to have arrived.                                                       */
+/*                                                                                    */
+/*  update() must be called once every control tick (20 msec) and never blocks.      */
+/*                                                                                    */
+/*------------------------------------------------------------------------------------*/
+
+//Percent velocity the wings travel at
+const double WING_VELOCITY = 50;
+//Amps above which a moving wing motor is considered loaded against its hard stop
+const double WING_STALL_CURRENT = 0.8;
+//Percent velocity below which a loaded wing motor is considered stalled
+const double WING_STALL_VELOCITY = 5;
+//Consecutive stalled ticks before the hard stop is accepted
+const int WING_STALL_TICKS = 3;
+//Ticks after a new command during which spin-up current is ignored
+const int WING_SPIN_UP_TICKS = 5;
+//Milliseconds of travel after which the wing is assumed to be at its hard stop
+const double WING_TRAVEL_TIMEOUT = 1000;
+//Volts used to hold the wing against its hard stop
+const double WING_HOLD_VOLTAGE = 1.5;
+
+class Wing{
+    public:
+        enum WingStates {UNKNOWN, OPENING, OPEN, CLOSING, CLOSED};
+
+        Wing(motor newWingMotor);
+        void open();
+        void close();
+        void update();
+        bool isOpen();
+        bool isClosed();
+        WingStates getState();
+
+    private:
+        vex::motor wingMotor;
+        WingStates state;
+        int spinUpTicks;
+        int stalledTicks;
+        vex::timer travelTimer;
+        void startTravel(WingStates newState);
+};
+
+Wing::Wing(motor newWingMotor) : wingMotor(newWingMotor){
+    state = UNKNOWN;
+    spinUpTicks = 0;
+    stalledTicks = 0;
+}
+
+void Wing::startTravel(WingStates newState){
+    state = newState;
+    spinUpTicks = 0;
+    stalledTicks = 0;
+    travelTimer.clear();
+    wingMotor.spin(newState == OPENING ? vex::directionType::fwd : vex::directionType::rev, WING_VELOCITY, vex::velocityUnits::pct);
+}
+
+void Wing::open(){
+    if(state != OPEN && state != OPENING){
+        startTravel(OPENING);
+    }
+}
+
+void Wing::close(){
+    if(state != CLOSED && state != CLOSING){
+        startTravel(CLOSING);
+    }
+}
+
+void Wing::update(){
+    if(state != OPENING && state != CLOSING){
+        return;
+    }
+
+    if(spinUpTicks < WING_SPIN_UP_TICKS){
+        spinUpTicks++;
+    }
+    else if(wingMotor.current(vex::currentUnits::amp) > WING_STALL_CURRENT && fabs(wingMotor.velocity(vex::velocityUnits::pct)) < WING_STALL_VELOCITY){
+        stalledTicks++;
+    }
+    else{
+        stalledTicks = 0;
+    }
+
+    //Hard stop reached - hold it there with low power
+    if(stalledTicks >= WING_STALL_TICKS || travelTimer.time(vex::timeUnits::msec) >= WING_TRAVEL_TIMEOUT){
+        vex::directionType holdDirection = state == OPENING ? vex::directionType::fwd : vex::directionType::rev;
+        state = state == OPENING ? OPEN : CLOSED;
+        wingMotor.spin(holdDirection, WING_HOLD_VOLTAGE, vex::voltageUnits::volt);
+    }
+}
+
+bool Wing::isOpen(){
+    return state == OPEN;
+}
+
+bool Wing::isClosed(){
+    return state == CLOSED;
+}
+
+Wing::WingStates Wing::getState(){
+    return state;
+}
+
+Wing leftWingController = Wing(leftWing);
+Wing rightWingController = Wing(rightWing);
+
 /*---------------------------------------------------------------------------*/
 /*                          Pre-Autonomous Functions                         */
 /*                                                                           */
@@ -111,7 +453,10 @@ void pre_auton(void) {
 
   //Set Default Brake Type For Non-Drive Motors to Hold
   nonDriveMotors.setStopping(vex::brakeType::hold);
-  wingMotors.setTimeout(2, vex::timeUnits::sec);
+
+  //Adds both puncher motors to the puncherLauncher
+  puncherLauncher.addMotor(puncher);
+  puncherLauncher.addMotor(puncher2);
 }
 
 /*---------------------------------------------------------------------------*/
@@ -142,8 +487,10 @@ void autonomous(void) {
 /*---------------------------------------------------------------------------*/
 
 void usercontrol(void) {
-  bool puncherState = true; ///TTTTTTEEEESSSTTT
+  bool puncherState = false;
   bool puncherLastState = false;
+  bool puncherFireLastState = false;
+  puncherLauncher.prime(); //Loads the puncher so the first shot fires instantly
 
   // User control code here, inside the loop
   while (1) {  
@@ -185,8 +532,9 @@ void usercontrol(void) {
     /*                              Puncher Controls                                      */
     /*                                                                                    */
     /*  One red motor gear-ratioed for torque that turns fwd/rev at 100% velocity         */
-    /*  to launch triballs through a puncher on a slip gear system.                       */
-    /*  Controls: Toggle - Y                                                              */  
+    /*  to launch triballs through a puncher on a slip gear system. puncherLauncher      */
+    /*  counts and times every shot and stops the puncher loaded between shots.           */
+    /*  Controls: Toggle Continuous - Y, Single Shot - A                                  */  
     /*                                                                                    */
     /*------------------------------------------------------------------------------------*/ 
 
@@ -198,35 +546,35 @@ void usercontrol(void) {
       puncherLastState = false;
    }
 
-   if(puncherState) {
-          puncher.spin(vex::directionType::fwd, 100, vex::velocityUnits::pct);
-          puncher2.spin(vex::directionType::fwd, 100, vex::velocityUnits::pct);
-   } else {
-      puncher.stop();
-      puncher2.stop();
+   puncherLauncher.setContinuous(puncherState);
+   if(Controller1.ButtonA.pressing() && !puncherState && !puncherFireLastState) {
+      puncherLauncher.fire();
+      puncherFireLastState = true;
+   } else if(!Controller1.ButtonA.pressing()) {
+      puncherFireLastState = false;
    }
+   puncherLauncher.update();
     /*------------------------------------------------------------------------------------*/
     /*                                                                                    */
     /*                              Wing Controls                                         */
     /*                                                                                    */
-    /*  Two 5.5w motor that control individual mechanisms that turns fwd/rev at 100%      */
-    /*  velocity to open/close wings that move triballs                                   */
-    /*  Manual Controls (Limited Mechanically): Open - L1/R1, Close - L2/R2               */
+    /*  Two 5.5w motor that control individual mechanisms that turns fwd/rev at 50%       */
+    /*  velocity to open/close wings that move triballs. Each wing stops itself at its    */
+    /*  hard stop and holds there with low power, so no tick waits on a wing.             */
+    /*  Controls: Open - L1, Close - R1                                                   */
     /*                                                                                    */
     /*------------------------------------------------------------------------------------*/ 
 
     if(Controller1.ButtonL1.pressing()){
-      leftWing.spinFor(vex::directionType::fwd, 100, vex::rotationUnits::deg, 50, vex::velocityUnits::pct, false);
-      rightWing.spinFor(vex::directionType::fwd, 100, vex::rotationUnits::deg, 50, vex::velocityUnits::pct, true);
+      leftWingController.open();
+      rightWingController.open();
     }
     else if(Controller1.ButtonR1.pressing()){
-      leftWing.spinFor(vex::directionType::rev, 100, vex::rotationUnits::deg, 50, vex::velocityUnits::pct, false);
-      rightWing.spinFor(vex::directionType::rev, 100, vex::rotationUnits::deg, 50, vex::velocityUnits::pct, true);
-    }
-    else{
-      leftWing.stop(vex::brakeType:: coast);
-      rightWing.stop(vex::brakeType::coast);
+      leftWingController.close();
+      rightWingController.close();
     }
+    leftWingController.update();
+    rightWingController.update();
     // }
     wait(20, msec); // Cooldown to prevent excess CPU usage and subsequent brain crashing
   } //End While Loop